@@ -17,6 +17,37 @@
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Timer.hpp>
 #include <Kokkos_Random.hpp>
+#include <Kokkos_AtomicAccumulator.hpp>
+
+// complex<double> with a user-provided copy constructor, which is not
+// trivially copyable, so that the host atomics on it take the lock array path
+// instead of cmpxchg16b
+struct LockedComplex {
+  double re;
+  double im;
+
+  KOKKOS_FUNCTION LockedComplex(double re_ = 0., double im_ = 0.)
+      : re(re_), im(im_) {}
+  KOKKOS_FUNCTION LockedComplex(const LockedComplex& src)
+      : re(src.re), im(src.im) {}
+  KOKKOS_FUNCTION LockedComplex& operator=(const LockedComplex& src) {
+    re = src.re;
+    im = src.im;
+    return *this;
+  }
+
+  KOKKOS_FUNCTION LockedComplex operator+(const LockedComplex& src) const {
+    return LockedComplex(re + src.re, im + src.im);
+  }
+  KOKKOS_FUNCTION LockedComplex operator*(const LockedComplex& src) const {
+    return LockedComplex(re * src.re - im * src.im, re * src.im + im * src.re);
+  }
+  KOKKOS_FUNCTION LockedComplex& operator+=(const LockedComplex& src) {
+    re += src.re;
+    im += src.im;
+    return *this;
+  }
+};
 
 template <class Scalar>
 double test_atomic(int L, int N, int M, int K, int R,
@@ -40,6 +71,34 @@ double test_atomic(int L, int N, int M, int K, int R,
   return time;
 }
 
+// Same updates as test_atomic, combined per thread before being added
+// atomically, the flush is part of the timing
+template <class Scalar>
+double test_accumulator(int L, int N, int M, int K, int R,
+                        Kokkos::View<const int**> offsets) {
+  Kokkos::View<Scalar*> output("Output", N);
+  Kokkos::Experimental::AtomicAccumulator<Scalar*> accumulator(output);
+  Kokkos::Timer timer;
+
+  for (int r = 0; r < R; r++) {
+    Kokkos::parallel_for(
+        L, KOKKOS_LAMBDA(const int& i) {
+          auto access = accumulator.access();
+          Scalar s    = 2;
+          for (int m = 0; m < M; m++) {
+            for (int k = 0; k < K; k++) s = s * s + s;
+            const int idx = (i + offsets(i, m)) % N;
+            access(idx) += s;
+          }
+        });
+    accumulator.flush();
+  }
+  Kokkos::fence();
+  double time = timer.seconds();
+
+  return time;
+}
+
 template <class Scalar>
 double test_no_atomic(int L, int N, int M, int K, int R,
                       Kokkos::View<const int**> offsets) {
@@ -77,6 +136,8 @@ int main(int argc, char* argv[]) {
       printf("       3 - float\n");
       printf("       4 - double\n");
       printf("       5 - complex<double>\n");
+      printf("       6 - complex<double> through the lock array\n");
+      printf("       7 - double through an AtomicAccumulator\n");
       printf("Example Input GPU:\n");
       printf("  Histogram : 1000000 1000 1 1000 1 10 1\n");
       printf("  MD Force : 100000 100000 100 1000 20 10 4\n");
@@ -103,6 +164,8 @@ int main(int argc, char* argv[]) {
     if (type == 4) time = test_atomic<double>(L, N, M, K, R, offsets);
     if (type == 5)
       time = test_atomic<Kokkos::complex<double> >(L, N, M, K, R, offsets);
+    if (type == 6) time = test_atomic<LockedComplex>(L, N, M, K, R, offsets);
+    if (type == 7) time = test_accumulator<double>(L, N, M, K, R, offsets);
 
     double time2 = 1;
     if (type == 1) time2 = test_no_atomic<int>(L, N, M, K, R, offsets);
@@ -111,6 +174,9 @@ int main(int argc, char* argv[]) {
     if (type == 4) time2 = test_no_atomic<double>(L, N, M, K, R, offsets);
     if (type == 5)
       time2 = test_no_atomic<Kokkos::complex<double> >(L, N, M, K, R, offsets);
+    if (type == 6)
+      time2 = test_no_atomic<LockedComplex>(L, N, M, K, R, offsets);
+    if (type == 7) time2 = test_no_atomic<double>(L, N, M, K, R, offsets);
 
     int size = 0;
     if (type == 1) size = sizeof(int);
@@ -118,18 +184,20 @@ int main(int argc, char* argv[]) {
     if (type == 3) size = sizeof(float);
     if (type == 4) size = sizeof(double);
     if (type == 5) size = sizeof(Kokkos::complex<double>);
+    if (type == 6) size = sizeof(LockedComplex);
+    if (type == 7) size = sizeof(double);
+
+    const char* type_names[] = {
+        "",        "int",     "long",           "float",
+        "double",  "complex", "locked_complex", "accumulated_double",
+    };
 
     printf("%i\n", size);
     printf(
         "Time: %s %i %i %i %i %i %i (t_atomic: %e t_nonatomic: %e ratio: %lf "
         ")( GUpdates/s: %lf GB/s: %lf )\n",
-        (type == 1)
-            ? "int"
-            : ((type == 2)
-                   ? "long"
-                   : ((type == 3) ? "float"
-                                  : ((type == 4) ? "double" : "complex"))),
-        L, N, M, D, K, R, time, time2, time / time2, 1.e-9 * L * R * M / time,
+        (type >= 1 && type <= 7) ? type_names[type] : "unknown", L, N, M, D, K,
+        R, time, time2, time / time2, 1.e-9 * L * R * M / time,
         1.0 * L * R * M * 2 * size / time / 1024 / 1024 / 1024);
   }
   Kokkos::finalize();
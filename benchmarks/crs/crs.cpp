@@ -0,0 +1,132 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/*! \brief file crs.cpp
+
+    Times the construction of a compressed row storage graph with
+    Kokkos::count_and_fill_crs and its transpose with Kokkos::transpose_crs.
+*/
+
+#include "Kokkos_Core.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <chrono>
+#include <algorithm>
+
+#define HLINE "-------------------------------------------------------------\n"
+
+using Index = int;
+using Crs   = Kokkos::Crs<Index, Kokkos::DefaultExecutionSpace, void, Index>;
+
+using Clock    = std::chrono::steady_clock;
+using Duration = std::chrono::duration<double>;
+
+// Row i has degree entries, spread over the whole graph or, with a band,
+// within band rows of the diagonal
+struct FillRows {
+  Index rows;
+  Index degree;
+  Index band;
+
+  KOKKOS_FUNCTION Index operator()(const Index row, Index* fill) const {
+    if (fill) {
+      for (Index k = 0; k < degree; ++k) {
+        // Knuth's multiplicative hash of the position of the entry
+        const uint32_t hash =
+            uint32_t(int64_t(row) * degree + k) * uint32_t(2654435761u);
+        if (band > 0) {
+          fill[k] = Index((row + int64_t(hash % uint32_t(2 * band + 1)) -
+                           band + rows) %
+                          rows);
+        } else {
+          fill[k] = Index(hash % uint32_t(rows));
+        }
+      }
+    }
+    return degree;
+  }
+};
+
+int run_benchmark(const Index rows, const Index degree, const Index band,
+                  const int repeats) {
+  const double entries = double(rows) * double(degree);
+  printf("Reports fastest timing per operation\n");
+  printf("- Rows:          %15d\n", rows);
+  printf("- Entries:       %15.0f (%12.4f MB)\n", entries,
+         1.0e-6 * entries * sizeof(Index));
+  printf("- Band:          %15s\n",
+         band > 0 ? std::to_string(band).c_str() : "none");
+  printf(HLINE);
+
+  double build_time     = 1.0e30;
+  double transpose_time = 1.0e30;
+  for (int k = 0; k < repeats; ++k) {
+    Crs graph;
+    auto start = Clock::now();
+    Kokkos::count_and_fill_crs(graph, rows, FillRows{rows, degree, band});
+    Kokkos::fence();
+    build_time = std::min(build_time, Duration(Clock::now() - start).count());
+
+    Crs transpose;
+    start = Clock::now();
+    Kokkos::transpose_crs(transpose, graph);
+    Kokkos::fence();
+    transpose_time =
+        std::min(transpose_time, Duration(Clock::now() - start).count());
+  }
+
+  printf("Build:     %12.6f s %12.3f M entries/s\n", build_time,
+         1.0e-6 * entries / build_time);
+  printf("Transpose: %12.6f s %12.3f M entries/s\n", transpose_time,
+         1.0e-6 * entries / transpose_time);
+  printf(HLINE);
+
+  return 0;
+}
+
+int main(int argc, char* argv[]) {
+  printf(HLINE);
+  printf("Kokkos CRS Build and Transpose Benchmark\n");
+  printf(HLINE);
+
+  Kokkos::initialize(argc, argv);
+
+  // 10^8 entries by default
+  Index rows   = 1000000;
+  Index degree = 100;
+  Index band   = 0;
+  int repeats  = 5;
+
+  for (int i = 1; i + 1 < argc; ++i) {
+    if (strcmp(argv[i], "--rows") == 0) {
+      rows = std::atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--degree") == 0) {
+      degree = std::atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--band") == 0) {
+      band = std::atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--repeats") == 0) {
+      repeats = std::atoi(argv[++i]);
+    }
+  }
+
+  const int rc = run_benchmark(rows, degree, band, repeats);
+
+  Kokkos::finalize();
+
+  return rc;
+}
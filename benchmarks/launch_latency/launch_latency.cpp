@@ -66,6 +66,7 @@ struct Opts {
   bool par_for         = true;
   bool par_reduce      = true;
   bool par_reduce_view = true;
+  bool labeled         = true;
 };
 
 template <int V>
@@ -102,6 +103,11 @@ void run(int N, int M, int K, const Opts& opts) {
     ostream << "RunReduceViewFence_" << N << "_" << K << std::endl;
     l_red_view_fence = ostream.str();
   }
+  if (!opts.labeled) {
+    // the names of the kernels are then derived from the functor types
+    l_no_fence = l_fence = l_red_no_fence = l_red_fence = l_red_view_no_fence =
+        l_red_view_fence = "";
+  }
 
   double result;
   Kokkos::View<double*> a("A", N);
@@ -237,6 +243,11 @@ int main(int argc, char* argv[]) {
     printf(
         "  --no-parallel-reduce-view: skip parallel_reduce into view "
         "benchmark\n");
+    printf("  --unlabeled:               launch kernels without a label\n");
+    printf("\n");
+    printf(
+        "  Pass --kokkos-kernel-statistics to measure the launches with a "
+        "tool\n");
     printf("\n\n");
     printf("  Output V is the size of the functor member array\n");
     printf("\n\n");
@@ -262,6 +273,8 @@ int main(int argc, char* argv[]) {
         opts.par_reduce = false;
       } else if (arg == "--no-parallel-reduce-view") {
         opts.par_reduce_view = false;
+      } else if (arg == "--unlabeled") {
+        opts.labeled = false;
       } else {
         std::stringstream ss;
         ss << "unexpected argument \"" << arg << "\" at position " << i;
@@ -93,6 +93,8 @@ KOKKOS_ENABLE_OPTION(DESUL_ATOMICS_EXTERNAL OFF "Whether to use an external desu
 KOKKOS_ENABLE_OPTION(ATOMICS_BYPASS OFF "**NOT RECOMMENDED** Whether to make atomics non-atomic for non-threaded MPI-only use cases")
 KOKKOS_ENABLE_OPTION(IMPL_REF_COUNT_BRANCH_UNLIKELY ON "Whether to use the C++20 `[[unlikely]]` attribute in the view reference counting")
 mark_as_advanced(Kokkos_ENABLE_IMPL_REF_COUNT_BRANCH_UNLIKELY)
+KOKKOS_ENABLE_OPTION(IMPL_MDRANGE_OMP_SIMD ON "Whether to vectorize the innermost loop of the tiles of host MDRangePolicy parallel_for with omp simd")
+mark_as_advanced(Kokkos_ENABLE_IMPL_MDRANGE_OMP_SIMD)
 KOKKOS_ENABLE_OPTION(IMPL_VIEW_OF_VIEWS_DESTRUCTOR_PRECONDITION_VIOLATION_WORKAROUND OFF "Whether to enable a workaround for invalid use of View of Views that causes program hang on destruction.")
 mark_as_advanced(Kokkos_ENABLE_IMPL_VIEW_OF_VIEWS_DESTRUCTOR_PRECONDITION_VIOLATION_WORKAROUND)
 
@@ -133,6 +135,7 @@ ELSE()
   SET(HPX_ASYNC_DISPATCH_DEFAULT OFF)
 ENDIF()
 KOKKOS_ENABLE_OPTION(IMPL_HPX_ASYNC_DISPATCH ${HPX_ASYNC_DISPATCH_DEFAULT} "Whether HPX supports asynchronous dispatch")
+KOKKOS_ENABLE_OPTION(IMPL_OPENMP_ASYNC_DISPATCH OFF "Whether OpenMP execution space instances dispatch asynchronously")
 
 Kokkos_ENABLE_OPTION(UNSUPPORTED_ARCHS OFF "Whether to allow architectures in backends Kokkos doesn't optimize for")
 
@@ -154,6 +157,7 @@ ENDFUNCTION()
 CHECK_DEVICE_SPECIFIC_OPTIONS(DEVICE CUDA OPTIONS CUDA_UVM CUDA_RELOCATABLE_DEVICE_CODE CUDA_LAMBDA CUDA_CONSTEXPR CUDA_LDG_INTRINSIC IMPL_CUDA_MALLOC_ASYNC IMPL_CUDA_UNIFIED_MEMORY)
 CHECK_DEVICE_SPECIFIC_OPTIONS(DEVICE HIP OPTIONS HIP_RELOCATABLE_DEVICE_CODE HIP_MULTIPLE_KERNEL_INSTANTIATIONS IMPL_HIP_UNIFIED_MEMORY)
 CHECK_DEVICE_SPECIFIC_OPTIONS(DEVICE HPX OPTIONS IMPL_HPX_ASYNC_DISPATCH)
+CHECK_DEVICE_SPECIFIC_OPTIONS(DEVICE OPENMP OPTIONS IMPL_OPENMP_ASYNC_DISPATCH)
 CHECK_DEVICE_SPECIFIC_OPTIONS(DEVICE OPENACC OPTIONS OPENACC_FORCE_HOST_AS_DEVICE)
 
 # Needed due to change from deprecated name to new header define name
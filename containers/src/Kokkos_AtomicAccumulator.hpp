@@ -0,0 +1,253 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_AtomicAccumulator.hpp
+/// \brief Declaration and definition of
+///        Kokkos::Experimental::AtomicAccumulator.
+///
+/// This header file declares and defines AtomicAccumulator, which combines
+/// the atomic additions into a View in per-thread caches.
+
+#ifndef KOKKOS_ATOMIC_ACCUMULATOR_HPP
+#define KOKKOS_ATOMIC_ACCUMULATOR_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_ATOMICACCUMULATOR
+#endif
+
+#include <Kokkos_Core.hpp>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+
+template <typename DataType, typename... Properties>
+class AtomicAccumulatorAccess;
+
+/** \brief Sums contributions into the entries of a rank-1 View, combining
+ *         the contributions of a thread to the same entry before adding them
+ *         atomically.
+ *
+ *  Each thread of a host execution space owns a small direct-mapped cache of
+ *  entries.  A contribution to a cached entry is a plain addition, a
+ *  contribution to another entry first evicts the one in its slot with an
+ *  atomic addition into the View.  Heavily contended entries, like global
+ *  counters or the hot bins of a histogram, thus receive one atomic per thread
+ *  and eviction instead of one per contribution.
+ *
+ *  Like for ScatterView, the contributions are only guaranteed to be in the
+ *  View after flush(), typically called right after the kernels contributing
+ *  to it.  Between flushes the accumulator can be used by several kernels,
+ *  but not by concurrent ones.  On other execution spaces the contributions
+ *  are plain atomic additions and flush() does nothing.
+ */
+template <typename DataType, typename... Properties>
+class AtomicAccumulator {
+ public:
+  using target_view_type = Kokkos::View<DataType, Properties...>;
+  using execution_space  = typename target_view_type::execution_space;
+  using memory_space     = typename target_view_type::memory_space;
+  using value_type       = typename target_view_type::non_const_value_type;
+  using access_type      = AtomicAccumulatorAccess<DataType, Properties...>;
+
+  static_assert(target_view_type::rank == 1,
+                "AtomicAccumulator only supports rank-1 Views");
+
+  // Whether the contributions are combined, otherwise they are plain atomics
+  static constexpr bool is_combining =
+      std::is_same_v<typename execution_space::memory_space,
+                     Kokkos::HostSpace>;
+
+  static constexpr int default_cache_size = 64;
+
+  AtomicAccumulator() = default;
+
+  /// \param target View the contributions are added to
+  /// \param cache_size number of entries cached per thread, a power of two
+  explicit AtomicAccumulator(target_view_type const& target,
+                             int cache_size = default_cache_size)
+      : m_target(target) {
+    if (cache_size <= 0 || (cache_size & (cache_size - 1)) != 0) {
+      Kokkos::abort(
+          "Kokkos::Experimental::AtomicAccumulator: the cache size must be a "
+          "power of two");
+    }
+    if constexpr (is_combining) {
+      m_mask = cache_size - 1;
+      m_values =
+          Kokkos::View<value_type**, Kokkos::LayoutRight, memory_space>(
+              "Kokkos::AtomicAccumulator::values", m_unique_token.size(),
+              cache_size);
+      m_indices = Kokkos::View<int64_t**, Kokkos::LayoutRight, memory_space>(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                             "Kokkos::AtomicAccumulator::indices"),
+          m_unique_token.size(), cache_size);
+      Kokkos::deep_copy(m_indices, int64_t(-1));
+    }
+  }
+
+  KOKKOS_FUNCTION target_view_type const& target() const { return m_target; }
+
+  KOKKOS_FUNCTION access_type access() const { return access_type(*this); }
+
+  /// \brief Adds the cached contributions into the View.
+  void flush(execution_space const& exec) const {
+    if constexpr (is_combining) {
+      Kokkos::parallel_for(
+          "Kokkos::AtomicAccumulator::flush",
+          Kokkos::RangePolicy<execution_space, FlushTag>(exec, 0,
+                                                         m_indices.extent(0)),
+          *this);
+    }
+  }
+
+  void flush() const { flush(execution_space()); }
+
+  struct FlushTag {};
+
+  KOKKOS_FUNCTION void operator()(FlushTag, const int thread) const {
+    for (int slot = 0; slot <= m_mask; ++slot) evict(thread, slot);
+  }
+
+ private:
+  friend access_type;
+
+  KOKKOS_FUNCTION void evict(const int thread, const int slot) const {
+    const int64_t index = m_indices(thread, slot);
+    if (index >= 0) {
+      Kokkos::atomic_add(&m_target(index), m_values(thread, slot));
+      m_indices(thread, slot) = -1;
+    }
+  }
+
+  KOKKOS_FUNCTION void contribute(const int thread, const int64_t index,
+                                  value_type const& value) const {
+    const int slot = static_cast<int>(index & m_mask);
+    if (m_indices(thread, slot) == index) {
+      m_values(thread, slot) += value;
+    } else {
+      evict(thread, slot);
+      m_indices(thread, slot) = index;
+      m_values(thread, slot)  = value;
+    }
+  }
+
+  using unique_token_type = Kokkos::Experimental::UniqueToken<
+      execution_space, Kokkos::Experimental::UniqueTokenScope::Global>;
+
+  target_view_type m_target;
+  unique_token_type m_unique_token;
+  Kokkos::View<value_type**, Kokkos::LayoutRight, memory_space> m_values;
+  Kokkos::View<int64_t**, Kokkos::LayoutRight, memory_space> m_indices;
+  int m_mask = 0;
+};
+
+/* Like ScatterAccess, holds the thread ID for the lifetime of a parallel
+   iterate so that it is acquired once instead of at every contribution */
+template <typename DataType, typename... Properties>
+class AtomicAccumulatorAccess {
+ public:
+  using accumulator_type = AtomicAccumulator<DataType, Properties...>;
+  using value_type       = typename accumulator_type::value_type;
+
+  class reference {
+   public:
+    KOKKOS_FORCEINLINE_FUNCTION void operator+=(value_type const& value) const {
+      m_access.add(m_index, value);
+    }
+    KOKKOS_FORCEINLINE_FUNCTION void operator-=(value_type const& value) const {
+      m_access.add(m_index, -value);
+    }
+    KOKKOS_FORCEINLINE_FUNCTION void operator++() const {
+      m_access.add(m_index, value_type(1));
+    }
+    KOKKOS_FORCEINLINE_FUNCTION void operator++(int) const {
+      m_access.add(m_index, value_type(1));
+    }
+
+   private:
+    friend AtomicAccumulatorAccess;
+    KOKKOS_FORCEINLINE_FUNCTION reference(AtomicAccumulatorAccess const& access,
+                                          int64_t index)
+        : m_access(access), m_index(index) {}
+
+    AtomicAccumulatorAccess const& m_access;
+    int64_t m_index;
+  };
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  explicit AtomicAccumulatorAccess(accumulator_type const& accumulator)
+      : m_accumulator(accumulator) {
+    if constexpr (accumulator_type::is_combining) {
+      m_thread_id = m_accumulator.m_unique_token.acquire();
+    }
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  ~AtomicAccumulatorAccess() {
+    if constexpr (accumulator_type::is_combining) {
+      if (m_thread_id != ~thread_id_type(0))
+        m_accumulator.m_unique_token.release(m_thread_id);
+    }
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void add(int64_t index,
+                                       value_type const& value) const {
+    if constexpr (accumulator_type::is_combining) {
+      m_accumulator.contribute(m_thread_id, index, value);
+    } else {
+      Kokkos::atomic_add(&m_accumulator.m_target(index), value);
+    }
+  }
+
+  template <typename Arg>
+  KOKKOS_FORCEINLINE_FUNCTION reference operator()(Arg index) const {
+    return reference(*this, index);
+  }
+
+  template <typename Arg>
+  KOKKOS_FORCEINLINE_FUNCTION reference operator[](Arg index) const {
+    return reference(*this, index);
+  }
+
+  // simplify RAII by disallowing copies, moves are needed for
+  // auto b = a.access();
+  AtomicAccumulatorAccess(AtomicAccumulatorAccess const&)            = delete;
+  AtomicAccumulatorAccess& operator=(AtomicAccumulatorAccess const&) = delete;
+  AtomicAccumulatorAccess& operator=(AtomicAccumulatorAccess&&)      = delete;
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  AtomicAccumulatorAccess(AtomicAccumulatorAccess&& other)
+      : m_accumulator(other.m_accumulator), m_thread_id(other.m_thread_id) {
+    other.m_thread_id = ~thread_id_type(0);
+  }
+
+ private:
+  using thread_id_type =
+      typename accumulator_type::unique_token_type::size_type;
+
+  accumulator_type const& m_accumulator;
+  thread_id_type m_thread_id = ~thread_id_type(0);
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_ATOMICACCUMULATOR
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_ATOMICACCUMULATOR
+#endif
+#endif
@@ -34,6 +34,9 @@ class Bitset;
 template <typename Device = Kokkos::DefaultExecutionSpace>
 class ConstBitset;
 
+template <typename Device = Kokkos::DefaultExecutionSpace>
+class BitsetRankIndex;
+
 template <typename DstDevice, typename SrcDevice>
 void deep_copy(Bitset<DstDevice>& dst, Bitset<SrcDevice> const& src);
 
@@ -152,6 +155,44 @@ class Bitset {
   /// can only be called from the host
   void clear() { Kokkos::deep_copy(m_blocks, 0u); }
 
+  /// set each bit to the bitwise and of itself and the same bit of other
+  /// can only be called from the host
+  void bitwise_and(ConstBitset<Device> const& other) {
+    apply_binary_op<Impl::BitsetAnd>("Kokkos::Bitset::bitwise_and", other);
+  }
+
+  /// set each bit to the bitwise or of itself and the same bit of other
+  /// can only be called from the host
+  void bitwise_or(ConstBitset<Device> const& other) {
+    apply_binary_op<Impl::BitsetOr>("Kokkos::Bitset::bitwise_or", other);
+  }
+
+  /// set each bit to the bitwise xor of itself and the same bit of other
+  /// can only be called from the host
+  void bitwise_xor(ConstBitset<Device> const& other) {
+    apply_binary_op<Impl::BitsetXor>("Kokkos::Bitset::bitwise_xor", other);
+  }
+
+  /// reset each bit which is set in other
+  /// can only be called from the host
+  void bitwise_andnot(ConstBitset<Device> const& other) {
+    apply_binary_op<Impl::BitsetAndNot>("Kokkos::Bitset::bitwise_andnot",
+                                        other);
+  }
+
+  /// call functor(i) in parallel for every bit i which is set to 1
+  /// the set bits of a block are found with bit scans, so the cost is
+  /// proportional to the number of blocks plus the number of set bits
+  /// can only be called from the host
+  template <class Functor>
+  void for_each_set_bit(const std::string& label,
+                        const Functor& functor) const {
+    Kokkos::parallel_for(
+        label, Kokkos::RangePolicy<execution_space>(0, m_blocks.extent(0)),
+        Impl::BitsetForEachSetBit<block_view_type, Functor>{m_blocks,
+                                                            functor});
+  }
+
   /// set i'th bit to 1
   /// can only be called from the device
   KOKKOS_FORCEINLINE_FUNCTION
@@ -250,6 +291,20 @@ class Bitset {
   }
 
  private:
+  template <typename Op>
+  void apply_binary_op(const std::string& label,
+                       ConstBitset<Device> const& other) {
+    if (m_size != other.m_size) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Error: Cannot combine bitsets of different sizes!");
+    }
+    Kokkos::parallel_for(
+        label, Kokkos::RangePolicy<execution_space>(0, m_blocks.extent(0)),
+        Impl::BitsetBinaryOp<block_view_type,
+                             typename ConstBitset<Device>::block_view_type, Op>{
+            m_blocks, other.m_blocks});
+  }
+
   KOKKOS_FORCEINLINE_FUNCTION
   Kokkos::pair<bool, unsigned> find_any_helper(unsigned block_idx,
                                                unsigned offset, unsigned block,
@@ -374,14 +429,29 @@ class ConstBitset {
     return false;
   }
 
+  template <class Functor>
+  void for_each_set_bit(const std::string& label,
+                        const Functor& functor) const {
+    Kokkos::parallel_for(
+        label, Kokkos::RangePolicy<execution_space>(0, m_blocks.extent(0)),
+        Impl::BitsetForEachSetBit<block_view_type, Functor>{m_blocks,
+                                                            functor});
+  }
+
  private:
   unsigned m_size;
   block_view_type m_blocks;
 
  private:
+  template <typename DDevice>
+  friend class Bitset;
+
   template <typename DDevice>
   friend class ConstBitset;
 
+  template <typename DDevice>
+  friend class BitsetRankIndex;
+
   template <typename Bitset>
   friend struct Impl::BitsetCount;
 
@@ -394,6 +464,105 @@ class ConstBitset {
                         ConstBitset<SrcDevice> const& src);
 };
 
+/// An index over a bitset answering rank and select queries.
+///
+/// rank(i) is the number of bits set to 1 before bit i and is answered in
+/// constant time from a prefix count of the set bits per block.  select(k)
+/// is the position of the k'th bit set to 1 (counting from 0) and uses a
+/// binary search over the blocks.  The index is a snapshot: after the
+/// bitset is modified it has to be rebuilt with update().  Together with
+/// for_each_set_bit this can compact the set bits into a dense list,
+/// \code
+///   index.update();
+///   bitset.for_each_set_bit("compact", KOKKOS_LAMBDA(unsigned i) {
+///     list(index.rank(i)) = i;
+///   });
+/// \endcode
+template <typename Device>
+class BitsetRankIndex {
+ public:
+  using execution_space = typename Device::execution_space;
+  using size_type       = unsigned int;
+
+ private:
+  enum : unsigned {
+    block_size = static_cast<unsigned>(sizeof(unsigned) * CHAR_BIT)
+  };
+  enum : unsigned { block_mask = block_size - 1u };
+  enum : unsigned {
+    block_shift = Kokkos::Impl::integral_power_of_two(block_size)
+  };
+
+  using block_view_type  = typename ConstBitset<Device>::block_view_type;
+  using prefix_view_type = View<unsigned*, Device>;
+
+ public:
+  BitsetRankIndex() = default;
+
+  /// build the index of the current content of bitset
+  /// can only be called from the host
+  BitsetRankIndex(ConstBitset<Device> const& bitset)
+      : m_size(bitset.m_size),
+        m_blocks(bitset.m_blocks),
+        m_prefix(view_alloc(WithoutInitializing, "Kokkos::BitsetRankIndex"),
+                 bitset.m_blocks.extent(0) + 1) {
+    update();
+  }
+
+  /// recompute the index after the bitset was modified
+  /// can only be called from the host
+  void update() {
+    m_count = 0;
+    Kokkos::parallel_scan(
+        "Kokkos::BitsetRankIndex::update",
+        Kokkos::RangePolicy<execution_space>(0, m_prefix.extent(0)),
+        Impl::BitsetPrefixCount<block_view_type, prefix_view_type>{m_blocks,
+                                                                   m_prefix},
+        m_count);
+  }
+
+  /// number of bits which were set to 1 when the index was built
+  KOKKOS_FORCEINLINE_FUNCTION
+  unsigned count() const { return m_count; }
+
+  /// number of bits set to 1 in [0, i)
+  /// can only be called from the device
+  KOKKOS_INLINE_FUNCTION
+  unsigned rank(unsigned i) const {
+    if (i >= m_size) return m_count;
+    const unsigned block_idx = i >> block_shift;
+    const unsigned mask      = (1u << (i & block_mask)) - 1u;
+    return m_prefix[block_idx] + Impl::bit_count(m_blocks[block_idx] & mask);
+  }
+
+  /// position of the k'th bit set to 1, or size() of the bitset if fewer
+  /// than k + 1 bits are set
+  /// can only be called from the device
+  KOKKOS_INLINE_FUNCTION
+  unsigned select(unsigned k) const {
+    if (k >= m_count) return m_size;
+    // last block whose prefix count does not exceed k
+    unsigned lo = 0;
+    unsigned hi = m_blocks.extent(0) - 1u;
+    while (lo < hi) {
+      const unsigned mid = lo + (hi - lo + 1u) / 2u;
+      if (m_prefix[mid] <= k)
+        lo = mid;
+      else
+        hi = mid - 1u;
+    }
+    unsigned block = m_blocks[lo];
+    for (unsigned j = m_prefix[lo]; j < k; ++j) block &= block - 1u;
+    return (lo << block_shift) + Impl::bit_scan_forward(block);
+  }
+
+ private:
+  unsigned m_size  = 0;
+  unsigned m_count = 0;
+  block_view_type m_blocks;
+  prefix_view_type m_prefix;
+};
+
 template <typename DstDevice, typename SrcDevice>
 void deep_copy(Bitset<DstDevice>& dst, Bitset<SrcDevice> const& src) {
   if (dst.size() != src.size()) {
@@ -85,6 +85,131 @@ inline const Kokkos::Cuda& get_cuda_space(const NonCudaExecSpace&) {
 
 #endif  // KOKKOS_ENABLE_CUDA
 
+/// \brief Dirty index ranges of a DualView, used by range-granular sync.
+///
+/// Keeps a small, sorted set of disjoint half-open ranges along the leading
+/// dimension that were modified on the most recently modified side since the
+/// last synchronization.  Once more than \c max_ranges disjoint ranges are
+/// recorded, the two neighbours separated by the smallest gap are coalesced,
+/// so the tracked set is always a superset of the modified entries.  The
+/// ranges are only valid for the View they were recorded against, which is
+/// identified by its data pointer, rank, leading extent and leading stride
+/// (subviews of a DualView share this object but generally index it
+/// differently).
+struct DualViewModifiedRanges {
+  static constexpr int max_ranges = 8;
+
+  const void* view_data = nullptr;
+  size_t view_extent    = 0;
+  size_t view_stride    = 0;
+  size_t view_rank      = 0;
+  bool full             = false;
+  int count             = 0;
+  size_t begin[max_ranges + 1];
+  size_t end[max_ranges + 1];
+
+  // statistics accumulated over the lifetime of the DualView
+  size_t bytes_synced  = 0;
+  size_t bytes_skipped = 0;
+
+  void reset() {
+    full  = false;
+    count = 0;
+  }
+
+  template <class V>
+  bool matches(const V& v) const {
+    return view_data == v.data() && view_extent == v.extent(0) &&
+           view_stride == v.stride_0() && view_rank == V::rank();
+  }
+
+  template <class V>
+  void record(const V& v) {
+    view_data   = v.data();
+    view_extent = v.extent(0);
+    view_stride = v.stride_0();
+    view_rank   = V::rank();
+  }
+
+  void insert(size_t b, size_t e) {
+    if (full || b >= e) return;
+    int i = 0;
+    while (i < count && end[i] < b) ++i;
+    int j = i;
+    while (j < count && begin[j] <= e) {
+      if (begin[j] < b) b = begin[j];
+      if (end[j] > e) e = end[j];
+      ++j;
+    }
+    // ranges [i, j) are absorbed into [b, e)
+    const int shift = 1 - (j - i);
+    if (shift > 0) {
+      for (int k = count - 1; k >= j; --k) {
+        begin[k + shift] = begin[k];
+        end[k + shift]   = end[k];
+      }
+    } else if (shift < 0) {
+      for (int k = j; k < count; ++k) {
+        begin[k + shift] = begin[k];
+        end[k + shift]   = end[k];
+      }
+    }
+    begin[i] = b;
+    end[i]   = e;
+    count += shift;
+
+    if (count > max_ranges) {
+      // coalesce the two neighbouring ranges with the smallest gap
+      int m = 0;
+      for (int k = 1; k + 1 < count; ++k) {
+        if (begin[k + 1] - end[k] < begin[m + 1] - end[m]) m = k;
+      }
+      end[m] = end[m + 1];
+      for (int k = m + 1; k + 1 < count; ++k) {
+        begin[k] = begin[k + 1];
+        end[k]   = end[k + 1];
+      }
+      --count;
+    }
+  }
+};
+
+// Subview of \p v restricted to the leading-dimension range \p r.
+template <class V, size_t... Is>
+auto dual_view_leading_subview(const V& v,
+                               const Kokkos::pair<size_t, size_t>& r,
+                               std::index_sequence<Is...>) {
+  return Kokkos::subview(v, r, ((void)Is, Kokkos::ALL)...);
+}
+
+/// \brief Copy the modified ranges of \p src into \p dst.
+///
+/// Returns false without copying anything if a range does not fit in the
+/// Views or if one of the corresponding subviews is not contiguous, in which
+/// case the whole View has to be copied.  Otherwise adds the number of bytes
+/// copied to \p bytes.
+template <class DstView, class SrcView, class... Args>
+bool dual_view_copy_modified_ranges(const DualViewModifiedRanges& ranges,
+                                    const DstView& dst, const SrcView& src,
+                                    size_t& bytes, Args const&... args) {
+  static_assert(DstView::rank() > 0);
+  constexpr auto trailing = std::make_index_sequence<DstView::rank() - 1>{};
+  for (int i = 0; i < ranges.count; ++i) {
+    const Kokkos::pair<size_t, size_t> r(ranges.begin[i], ranges.end[i]);
+    if (r.second > dst.extent(0) || r.second > src.extent(0) ||
+        !dual_view_leading_subview(dst, r, trailing).span_is_contiguous() ||
+        !dual_view_leading_subview(src, r, trailing).span_is_contiguous())
+      return false;
+  }
+  for (int i = 0; i < ranges.count; ++i) {
+    const Kokkos::pair<size_t, size_t> r(ranges.begin[i], ranges.end[i]);
+    auto dst_sub = dual_view_leading_subview(dst, r, trailing);
+    deep_copy(args..., dst_sub, dual_view_leading_subview(src, r, trailing));
+    bytes += dst_sub.size() * sizeof(typename DstView::value_type);
+  }
+  return true;
+}
+
 }  // namespace Impl
 
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_4
@@ -208,6 +333,12 @@ class DualView : public ViewTraits<DataType, Properties...> {
   using t_modified_flags = View<unsigned int[2], LayoutLeft, Kokkos::HostSpace>;
   t_modified_flags modified_flags;
 
+  // leading-dimension ranges modified since the last sync, see
+  // modify_host(size_t, size_t) and modify_device(size_t, size_t)
+  using t_modified_ranges =
+      View<Impl::DualViewModifiedRanges, Kokkos::HostSpace>;
+  t_modified_ranges modified_ranges;
+
  public:
   //@}
 
@@ -250,6 +381,9 @@ class DualView : public ViewTraits<DataType, Properties...> {
       : modified_flags(
             Kokkos::view_alloc(typename t_modified_flags::execution_space{},
                                "DualView::modified_flags")),
+        modified_ranges(
+            Kokkos::view_alloc(typename t_modified_ranges::execution_space{},
+                               "DualView::modified_ranges")),
         d_view(label, n0, n1, n2, n3, n4, n5, n6, n7),
         h_view(create_mirror_view(d_view))  // without UVM, host View mirrors
   {}
@@ -276,6 +410,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
            const size_t n6                   = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
            const size_t n7                   = KOKKOS_IMPL_CTOR_DEFAULT_ARG)
       : modified_flags(t_modified_flags("DualView::modified_flags")),
+        modified_ranges(t_modified_ranges("DualView::modified_ranges")),
         d_view(arg_prop, n0, n1, n2, n3, n4, n5, n6, n7) {
     // without UVM, host View mirrors
     if constexpr (Kokkos::Impl::has_type<Impl::WithoutInitializing_t,
@@ -289,6 +424,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
   template <typename DT, typename... DP>
   DualView(const DualView<DT, DP...>& src)
       : modified_flags(src.modified_flags),
+        modified_ranges(src.modified_ranges),
         d_view(src.d_view),
         h_view(src.h_view) {}
 
@@ -296,6 +432,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
   template <class DT, class... DP, class Arg0, class... Args>
   DualView(const DualView<DT, DP...>& src, const Arg0& arg0, Args... args)
       : modified_flags(src.modified_flags),
+        modified_ranges(src.modified_ranges),
         d_view(Kokkos::subview(src.d_view, arg0, args...)),
         h_view(Kokkos::subview(src.h_view, arg0, args...)) {}
 
@@ -311,6 +448,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
   /// \param h_view_ Host View (must have type t_host = t_dev::HostMirror)
   DualView(const t_dev& d_view_, const t_host& h_view_)
       : modified_flags(t_modified_flags("DualView::modified_flags")),
+        modified_ranges(t_modified_ranges("DualView::modified_ranges")),
         d_view(d_view_),
         h_view(h_view_) {
     if (int(d_view.rank) != int(h_view.rank) ||
@@ -542,6 +680,79 @@ class DualView : public ViewTraits<DataType, Properties...> {
     }
   }
 
+  bool impl_modified_ranges_are_valid() const {
+    if (modified_ranges.data() == nullptr) return false;
+    const Impl::DualViewModifiedRanges& ranges = modified_ranges();
+    return !ranges.full && ranges.count > 0 && ranges.matches(h_view);
+  }
+
+  /// \brief Copy \p src into \p dst as part of a sync.
+  ///
+  /// If only some leading-dimension ranges were marked as modified (see
+  /// modify_host(size_t, size_t)), only those ranges are copied, provided the
+  /// corresponding subviews are contiguous.  Otherwise the whole View is
+  /// copied.  Passing an execution space instance in \p args makes the copies
+  /// asynchronous with respect to the host.
+  template <class DstView, class SrcView, class... Args>
+  void impl_sync_copy(const DstView& dst, const SrcView& src,
+                      Args const&... args) {
+    const size_t bytes = src.size() * sizeof(typename t_dev::value_type);
+    size_t synced      = bytes;
+    bool done          = false;
+
+    if constexpr (t_dev::rank() > 0) {
+      if (impl_modified_ranges_are_valid()) {
+        size_t ranges_bytes = 0;
+        done = Impl::dual_view_copy_modified_ranges(modified_ranges(), dst, src,
+                                                    ranges_bytes, args...);
+        if (done) synced = ranges_bytes;
+      }
+    }
+    if (!done) deep_copy(args..., dst, src);
+
+    if (modified_ranges.data() != nullptr) {
+      Impl::DualViewModifiedRanges& ranges = modified_ranges();
+      ranges.bytes_synced += synced;
+      ranges.bytes_skipped += bytes - synced;
+      ranges.reset();
+    }
+  }
+
+  void impl_invalidate_modified_ranges() {
+    if (modified_ranges.data() != nullptr) modified_ranges().full = true;
+  }
+
+  void impl_reset_modified_ranges() {
+    if (modified_ranges.data() == nullptr)
+      modified_ranges = t_modified_ranges("DualView::modified_ranges");
+    else
+      modified_ranges().reset();
+  }
+
+  // Record [begin, end) as modified on side dev (0 = host, 1 = device).
+  void impl_add_modified_range(int dev, size_t begin, size_t end) {
+    if (modified_ranges.data() == nullptr)
+      modified_ranges = t_modified_ranges("DualView::modified_ranges");
+    Impl::DualViewModifiedRanges& ranges = modified_ranges();
+    if (ranges.full) return;
+
+    const unsigned int mine  = modified_flags(dev);
+    const unsigned int other = modified_flags(1 - dev);
+    if (other > mine || (mine > other && ranges.count == 0)) {
+      // either the other side holds newer data, or this side was modified
+      // without recording which part of it
+      ranges.full = true;
+      return;
+    }
+    if (ranges.count == 0) {
+      ranges.record(h_view);
+    } else if (!ranges.matches(h_view)) {
+      ranges.full = true;
+      return;
+    }
+    ranges.insert(begin, end);
+  }
+
   /// \brief Update data on device or host only if data in the other
   ///   space has been marked as modified.
   ///
@@ -578,7 +789,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
         }
 #endif
 
-        deep_copy(args..., d_view, h_view);
+        impl_sync_copy(d_view, h_view, args...);
         modified_flags(0) = modified_flags(1) = 0;
         impl_report_device_sync();
       }
@@ -595,7 +806,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
         }
 #endif
 
-        deep_copy(args..., h_view, d_view);
+        impl_sync_copy(h_view, d_view, args...);
         modified_flags(0) = modified_flags(1) = 0;
         impl_report_host_sync();
       }
@@ -688,7 +899,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
       }
 #endif
 
-      deep_copy(args..., h_view, d_view);
+      impl_sync_copy(h_view, d_view, args...);
       modified_flags(1) = modified_flags(0) = 0;
       impl_report_host_sync();
     }
@@ -719,7 +930,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
       }
 #endif
 
-      deep_copy(args..., d_view, h_view);
+      impl_sync_copy(d_view, h_view, args...);
       modified_flags(1) = modified_flags(0) = 0;
       impl_report_device_sync();
     }
@@ -778,6 +989,46 @@ class DualView : public ViewTraits<DataType, Properties...> {
           false);
     }
   }
+  // Increment the modified count of the host, leaving the modified ranges
+  // to the caller
+  void impl_mark_host_modified() {
+    modified_flags(0) =
+        (modified_flags(1) > modified_flags(0) ? modified_flags(1)
+                                               : modified_flags(0)) +
+        1;
+    impl_report_host_modification();
+#ifdef KOKKOS_ENABLE_DEBUG_DUALVIEW_MODIFY_CHECK
+    if (modified_flags(0) && modified_flags(1)) {
+      std::string msg = "Kokkos::DualView::modify_host ERROR: ";
+      msg += "Concurrent modification of host and device views ";
+      msg += "in DualView \"";
+      msg += d_view.label();
+      msg += "\"\n";
+      Kokkos::abort(msg.c_str());
+    }
+#endif
+  }
+
+  // Increment the modified count of the device, leaving the modified ranges
+  // to the caller
+  void impl_mark_device_modified() {
+    modified_flags(1) =
+        (modified_flags(1) > modified_flags(0) ? modified_flags(1)
+                                               : modified_flags(0)) +
+        1;
+    impl_report_device_modification();
+#ifdef KOKKOS_ENABLE_DEBUG_DUALVIEW_MODIFY_CHECK
+    if (modified_flags(0) && modified_flags(1)) {
+      std::string msg = "Kokkos::DualView::modify_device ERROR: ";
+      msg += "Concurrent modification of host and device views ";
+      msg += "in DualView \"";
+      msg += d_view.label();
+      msg += "\"\n";
+      Kokkos::abort(msg.c_str());
+    }
+#endif
+  }
+
   /// \brief Mark data as modified on the given device \c Device.
   ///
   /// If \c Device is the same as this DualView's device type, then
@@ -790,6 +1041,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
     if (modified_flags.data() == nullptr) {
       modified_flags = t_modified_flags("DualView::modified_flags");
     }
+    impl_invalidate_modified_ranges();
 
     int dev = get_device_side<Device>();
 
@@ -834,21 +1086,8 @@ class DualView : public ViewTraits<DataType, Properties...> {
                 nullptr>
   inline void modify_host() {
     if (modified_flags.data() != nullptr) {
-      modified_flags(0) =
-          (modified_flags(1) > modified_flags(0) ? modified_flags(1)
-                                                 : modified_flags(0)) +
-          1;
-      impl_report_host_modification();
-#ifdef KOKKOS_ENABLE_DEBUG_DUALVIEW_MODIFY_CHECK
-      if (modified_flags(0) && modified_flags(1)) {
-        std::string msg = "Kokkos::DualView::modify_host ERROR: ";
-        msg += "Concurrent modification of host and device views ";
-        msg += "in DualView \"";
-        msg += d_view.label();
-        msg += "\"\n";
-        Kokkos::abort(msg.c_str());
-      }
-#endif
+      impl_invalidate_modified_ranges();
+      impl_mark_host_modified();
     }
   }
 
@@ -864,21 +1103,8 @@ class DualView : public ViewTraits<DataType, Properties...> {
                 nullptr>
   inline void modify_device() {
     if (modified_flags.data() != nullptr) {
-      modified_flags(1) =
-          (modified_flags(1) > modified_flags(0) ? modified_flags(1)
-                                                 : modified_flags(0)) +
-          1;
-      impl_report_device_modification();
-#ifdef KOKKOS_ENABLE_DEBUG_DUALVIEW_MODIFY_CHECK
-      if (modified_flags(0) && modified_flags(1)) {
-        std::string msg = "Kokkos::DualView::modify_device ERROR: ";
-        msg += "Concurrent modification of host and device views ";
-        msg += "in DualView \"";
-        msg += d_view.label();
-        msg += "\"\n";
-        Kokkos::abort(msg.c_str());
-      }
-#endif
+      impl_invalidate_modified_ranges();
+      impl_mark_device_modified();
     }
   }
 
@@ -889,9 +1115,93 @@ class DualView : public ViewTraits<DataType, Properties...> {
     return;
   }
 
+  /// \brief Mark only the entries in [begin, end) of the leading dimension
+  ///   as modified on the given device \c Device.
+  ///
+  /// A subsequent sync copies only the recorded ranges instead of the whole
+  /// View, as long as the affected subviews are contiguous (e.g. LayoutRight
+  /// or rank 1).  Mixing with the whole-View modify() or modifying the other
+  /// side before syncing falls back to syncing everything.
+  template <class Device, class Dummy = DualView,
+            std::enable_if_t<!Dummy::impl_dualview_is_single_device::value>* =
+                nullptr>
+  void modify(size_t begin, size_t end) {
+    if (modified_flags.data() == nullptr) {
+      modified_flags = t_modified_flags("DualView::modified_flags");
+    }
+
+    int dev = get_device_side<Device>();
+
+    if (dev == 1) modify_device(begin, end);
+    if (dev == 0) modify_host(begin, end);
+  }
+
+  template <
+      class Device, class Dummy = DualView,
+      std::enable_if_t<Dummy::impl_dualview_is_single_device::value>* = nullptr>
+  void modify(size_t, size_t) {
+    return;
+  }
+
+  template <class Dummy = DualView,
+            std::enable_if_t<!Dummy::impl_dualview_is_single_device::value>* =
+                nullptr>
+  inline void modify_host(size_t begin, size_t end) {
+    if (modified_flags.data() != nullptr) {
+      impl_add_modified_range(0, begin, end);
+      impl_mark_host_modified();
+    }
+  }
+
+  template <
+      class Dummy = DualView,
+      std::enable_if_t<Dummy::impl_dualview_is_single_device::value>* = nullptr>
+  inline void modify_host(size_t, size_t) {
+    return;
+  }
+
+  template <class Dummy = DualView,
+            std::enable_if_t<!Dummy::impl_dualview_is_single_device::value>* =
+                nullptr>
+  inline void modify_device(size_t begin, size_t end) {
+    if (modified_flags.data() != nullptr) {
+      impl_add_modified_range(1, begin, end);
+      impl_mark_device_modified();
+    }
+  }
+
+  template <
+      class Dummy = DualView,
+      std::enable_if_t<Dummy::impl_dualview_is_single_device::value>* = nullptr>
+  inline void modify_device(size_t, size_t) {
+    return;
+  }
+
   inline void clear_sync_state() {
     if (modified_flags.data() != nullptr)
       modified_flags(1) = modified_flags(0) = 0;
+    if (modified_ranges.data() != nullptr) modified_ranges().reset();
+  }
+
+  //! Number of bytes copied by sync operations on this DualView.
+  size_t bytes_synced() const {
+    return modified_ranges.data() == nullptr ? 0
+                                             : modified_ranges().bytes_synced;
+  }
+
+  //! Number of bytes that sync operations skipped because they were not
+  //! marked as modified by modify_host(size_t, size_t) or
+  //! modify_device(size_t, size_t).
+  size_t bytes_skipped() const {
+    return modified_ranges.data() == nullptr ? 0
+                                             : modified_ranges().bytes_skipped;
+  }
+
+  void reset_sync_statistics() {
+    if (modified_ranges.data() != nullptr) {
+      modified_ranges().bytes_synced  = 0;
+      modified_ranges().bytes_skipped = 0;
+    }
   }
 
   //@}
@@ -948,6 +1258,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
       modified_flags = t_modified_flags("DualView::modified_flags");
     } else
       modified_flags(1) = modified_flags(0) = 0;
+    impl_reset_modified_ranges();
   }
 
   template <class... ViewCtorArgs>
@@ -1029,6 +1340,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
 
         /* Mark Device copy as modified */
         ++modified_flags(1);
+        impl_invalidate_modified_ranges();
       }
     };
 
@@ -1043,6 +1355,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
 
         /* Mark Host copy as modified */
         ++modified_flags(0);
+        impl_invalidate_modified_ranges();
       }
     };
 
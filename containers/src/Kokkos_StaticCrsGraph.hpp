@@ -467,6 +467,205 @@ DataType maximum_entry(const StaticCrsGraph<DataType, Arg1Type, Arg2Type,
   return result;
 }
 
+//----------------------------------------------------------------------------
+
+namespace Impl {
+
+/// Places the boundaries of a StaticCrsGraphRowPolicy along the merge path
+/// of rows and entries: block b starts at the coordinate (row, entry) whose
+/// accumulated cost is b * total_cost / num_blocks.  Rows cheaper than a
+/// block are never split, their boundary snaps to the row start.
+template <class RowMapType, class BoundaryType>
+struct StaticCrsGraphMergePathFunctor {
+  using size_type = typename BoundaryType::non_const_value_type;
+
+  RowMapType row_map;
+  BoundaryType block_rows;
+  BoundaryType block_entries;
+  size_type num_rows;
+  uint64_t cost_per_row;
+  uint64_t num_blocks;
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t row_start_cost(const size_type row) const {
+    return row_map(row) + row * cost_per_row;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_type block) const {
+    const uint64_t total_cost = row_start_cost(num_rows);
+    const uint64_t diagonal   = total_cost * block / num_blocks;
+
+    // last row starting at or before the diagonal
+    size_type lo = 0;
+    size_type hi = num_rows;
+    while (lo < hi) {
+      const size_type mid = lo + (hi - lo + 1) / 2;
+      if (row_start_cost(mid) <= diagonal)
+        lo = mid;
+      else
+        hi = mid - 1;
+    }
+
+    size_type entry = row_map(lo);
+    if (lo < num_rows) {
+      const uint64_t length    = row_map(lo + 1) - row_map(lo);
+      const uint64_t head_cost = row_start_cost(lo) + cost_per_row;
+      if (cost_per_row + length > total_cost / num_blocks &&
+          diagonal > head_cost)
+        entry += diagonal - head_cost;
+    }
+    block_rows(block)    = lo;
+    block_entries(block) = entry;
+  }
+};
+
+template <class PolicyType, class FunctorType>
+struct StaticCrsGraphRowBlockFunctor {
+  PolicyType policy;
+  FunctorType functor;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const typename PolicyType::size_type block) const {
+    policy.for_each_segment(block, functor);
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/// \class StaticCrsGraphRowPolicy
+/// \brief Schedules the rows of a StaticCrsGraph in blocks of balanced cost.
+///
+/// The cost of a row is its number of entries plus a fixed \c cost_per_row,
+/// as in StaticCrsGraph::create_block_partitioning.  Block boundaries are
+/// placed along the merge path of rows and entries, so that rows whose cost
+/// exceeds the cost of a block are split across consecutive blocks.  By
+/// default there is one block per unit of concurrency of the execution
+/// space.  The partition is computed once at construction and can be reused
+/// for any number of launches on the same graph.
+///
+/// Kokkos::parallel_for with this policy calls
+/// \code
+///   functor(row, entry_begin, entry_end);
+/// \endcode
+/// for disjoint segments [entry_begin, entry_end) of the entries of each row.
+/// Rows without entries are visited exactly once.  A row that was split is
+/// visited once per block it spans, possibly concurrently, so contributions
+/// of partial rows must be combined with atomics.
+template <class GraphType,
+          class ExecutionSpace = typename GraphType::execution_space>
+class StaticCrsGraphRowPolicy {
+ public:
+  using execution_space = ExecutionSpace;
+  using graph_type      = GraphType;
+  using size_type       = typename GraphType::size_type;
+  using ordinal_type    = typename GraphType::data_type;
+
+ private:
+  using boundary_type =
+      View<size_type*, typename GraphType::array_layout,
+           Kokkos::Device<ExecutionSpace,
+                          typename GraphType::device_type::memory_space>>;
+
+  execution_space m_space;
+  typename GraphType::row_map_type m_row_map;
+  boundary_type m_block_rows;
+  boundary_type m_block_entries;
+  size_type m_num_rows   = 0;
+  size_type m_num_blocks = 0;
+
+ public:
+  StaticCrsGraphRowPolicy(const GraphType& graph, size_type num_blocks = 0,
+                          size_type cost_per_row = 4)
+      : StaticCrsGraphRowPolicy(execution_space(), graph, num_blocks,
+                                cost_per_row) {}
+
+  StaticCrsGraphRowPolicy(const execution_space& space, const GraphType& graph,
+                          size_type num_blocks = 0, size_type cost_per_row = 4)
+      : m_space(space),
+        m_row_map(graph.row_map),
+        m_num_rows(graph.numRows()),
+        m_num_blocks(num_blocks > 0 ? num_blocks : space.concurrency()) {
+    if (m_num_rows == 0) {
+      m_num_blocks = 0;
+      return;
+    }
+    m_block_rows =
+        boundary_type(view_alloc(WithoutInitializing, m_space,
+                                 "Kokkos::StaticCrsGraphRowPolicy::rows"),
+                      m_num_blocks + 1);
+    m_block_entries =
+        boundary_type(view_alloc(WithoutInitializing, m_space,
+                                 "Kokkos::StaticCrsGraphRowPolicy::entries"),
+                      m_num_blocks + 1);
+
+    Kokkos::Impl::StaticCrsGraphMergePathFunctor<
+        typename GraphType::row_map_type, boundary_type>
+        partitioner{m_row_map,  m_block_rows, m_block_entries,
+                    m_num_rows, cost_per_row, m_num_blocks};
+    Kokkos::parallel_for(
+        "Kokkos::StaticCrsGraphRowPolicy::partition",
+        Kokkos::RangePolicy<execution_space, IndexType<size_type>>(
+            m_space, 0, m_num_blocks + 1),
+        partitioner);
+  }
+
+  const execution_space& space() const { return m_space; }
+
+  KOKKOS_INLINE_FUNCTION size_type num_blocks() const { return m_num_blocks; }
+
+  /// \brief Call \c functor(row, entry_begin, entry_end) on every row
+  ///   segment of \c block.
+  template <class FunctorType>
+  KOKKOS_INLINE_FUNCTION void for_each_segment(
+      const size_type block, const FunctorType& functor) const {
+    const size_type first_row   = m_block_rows(block);
+    const size_type last_row    = m_block_rows(block + 1);
+    const size_type first_entry = m_block_entries(block);
+    const size_type last_entry  = m_block_entries(block + 1);
+
+    for (size_type row = first_row; row <= last_row && row < m_num_rows;
+         ++row) {
+      const size_type row_begin = m_row_map(row);
+      const size_type begin     = row == first_row ? first_entry : row_begin;
+      const size_type end = row == last_row ? last_entry : m_row_map(row + 1);
+      // the segment holding the start of a row visits it even if it is empty
+      const bool head = begin == row_begin && (row < last_row || end > begin);
+      if (head || begin < end)
+        functor(static_cast<ordinal_type>(row), begin, end);
+    }
+  }
+};
+
+}  // namespace Experimental
+
+template <class GraphType, class ExecutionSpace, class FunctorType>
+inline void parallel_for(
+    const std::string& str,
+    const Experimental::StaticCrsGraphRowPolicy<GraphType, ExecutionSpace>&
+        policy,
+    const FunctorType& functor) {
+  using policy_type =
+      Experimental::StaticCrsGraphRowPolicy<GraphType, ExecutionSpace>;
+  using size_type = typename policy_type::size_type;
+  Kokkos::parallel_for(
+      str,
+      Kokkos::RangePolicy<ExecutionSpace, IndexType<size_type>>(
+          policy.space(), 0, policy.num_blocks()),
+      Impl::StaticCrsGraphRowBlockFunctor<policy_type, FunctorType>{policy,
+                                                                    functor});
+}
+
+template <class GraphType, class ExecutionSpace, class FunctorType>
+inline void parallel_for(
+    const Experimental::StaticCrsGraphRowPolicy<GraphType, ExecutionSpace>&
+        policy,
+    const FunctorType& functor) {
+  Kokkos::parallel_for("", policy, functor);
+}
+
 }  // namespace Kokkos
 
 //----------------------------------------------------------------------------
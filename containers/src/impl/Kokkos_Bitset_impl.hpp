@@ -65,6 +65,70 @@ struct BitsetCount {
   }
 };
 
+struct BitsetAnd {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static unsigned apply(unsigned a, unsigned b) { return a & b; }
+};
+
+struct BitsetOr {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static unsigned apply(unsigned a, unsigned b) { return a | b; }
+};
+
+struct BitsetXor {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static unsigned apply(unsigned a, unsigned b) { return a ^ b; }
+};
+
+struct BitsetAndNot {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static unsigned apply(unsigned a, unsigned b) { return a & ~b; }
+};
+
+/// Combines the blocks of two bitsets word by word, dst = Op(dst, src).
+template <typename DstBlocks, typename SrcBlocks, typename Op>
+struct BitsetBinaryOp {
+  DstBlocks m_dst;
+  SrcBlocks m_src;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(unsigned i) const {
+    m_dst[i] = Op::apply(m_dst[i], m_src[i]);
+  }
+};
+
+/// Calls the functor with the index of every set bit of a block.
+template <typename Blocks, typename Functor>
+struct BitsetForEachSetBit {
+  Blocks m_blocks;
+  Functor m_functor;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(unsigned i) const {
+    constexpr unsigned block_size = sizeof(unsigned) * CHAR_BIT;
+    unsigned block                = m_blocks[i];
+    while (block) {
+      m_functor(i * block_size + bit_scan_forward(block));
+      block &= block - 1u;  // clear the lowest set bit
+    }
+  }
+};
+
+/// Exclusive prefix count of the set bits per block.
+template <typename Blocks, typename PrefixView>
+struct BitsetPrefixCount {
+  using value_type = unsigned;
+
+  Blocks m_blocks;
+  PrefixView m_prefix;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(unsigned i, value_type& update, const bool final) const {
+    if (final) m_prefix[i] = update;
+    if (i < m_blocks.extent(0)) update += bit_count(m_blocks[i]);
+  }
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
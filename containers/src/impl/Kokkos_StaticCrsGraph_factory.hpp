@@ -103,11 +103,17 @@ inline typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
 
     typename work_type::HostMirror row_work_host = create_mirror_view(row_work);
 
-    size_t sum       = 0;
-    row_work_host[0] = 0;
-    for (size_t i = 0; i < length; ++i) {
-      row_work_host[i + 1] = sum += input[i];
-    }
+    const InputSizeType* const row_sizes = input.data();
+    size_t sum                           = 0;
+    row_work_host[0]                     = 0;
+    Kokkos::parallel_scan(
+        "Kokkos::create_staticcrsgraph::row_map",
+        RangePolicy<DefaultHostExecutionSpace>(0, length),
+        [=](const size_t i, size_t& update, const bool final_pass) {
+          update += row_sizes[i];
+          if (final_pass) row_work_host[i + 1] = update;
+        },
+        sum);
 
     deep_copy(row_work, row_work_host);
 
@@ -139,16 +145,22 @@ inline typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
 
   const size_t length = input.size();
 
-  {
-    work_type row_work("tmp", length + 1);
+  work_type row_work("tmp", length + 1);
 
-    typename work_type::HostMirror row_work_host = create_mirror_view(row_work);
+  typename work_type::HostMirror row_work_host = create_mirror_view(row_work);
 
+  const std::vector<InputSizeType>* const rows = input.data();
+  {
     size_t sum       = 0;
     row_work_host[0] = 0;
-    for (size_t i = 0; i < length; ++i) {
-      row_work_host[i + 1] = sum += input[i].size();
-    }
+    Kokkos::parallel_scan(
+        "Kokkos::create_staticcrsgraph::row_map",
+        RangePolicy<DefaultHostExecutionSpace>(0, length),
+        [=](const size_t i, size_t& update, const bool final_pass) {
+          update += rows[i].size();
+          if (final_pass) row_work_host[i + 1] = update;
+        },
+        sum);
 
     deep_copy(row_work, row_work_host);
 
@@ -161,12 +173,15 @@ inline typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
     typename entries_type::HostMirror host_entries =
         create_mirror_view(output.entries);
 
-    size_t sum = 0;
-    for (size_t i = 0; i < length; ++i) {
-      for (size_t j = 0; j < input[i].size(); ++j, ++sum) {
-        host_entries(sum) = input[i][j];
-      }
-    }
+    Kokkos::parallel_for(
+        "Kokkos::create_staticcrsgraph::entries",
+        RangePolicy<DefaultHostExecutionSpace>(0, length),
+        [=](const size_t i) {
+          const size_t begin = row_work_host[i];
+          for (size_t j = 0; j < rows[i].size(); ++j) {
+            host_entries(begin + j) = rows[i][j];
+          }
+        });
 
     deep_copy(output.entries, host_entries);
   }
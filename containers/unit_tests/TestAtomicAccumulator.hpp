@@ -0,0 +1,86 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_ATOMIC_ACCUMULATOR_HPP
+#define KOKKOS_TEST_ATOMIC_ACCUMULATOR_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_AtomicAccumulator.hpp>
+
+namespace Test {
+
+// Every iteration contributes to a hot bin shared by all the iterations and to
+// a cold bin, with enough distinct cold bins to evict cached entries
+template <class Accumulator>
+struct HistogramFunctor {
+  Accumulator accumulator;
+  int num_bins;
+
+  KOKKOS_FUNCTION void operator()(const int i) const {
+    auto access = accumulator.access();
+    access(0) += 1;
+    access(1 + i % (num_bins - 1)) += 2;
+    access[num_bins] -= 1;
+    access(num_bins + 1)++;
+  }
+};
+
+template <class DeviceType>
+void test_atomic_accumulator(int cache_size) {
+  using view_type        = Kokkos::View<long*, DeviceType>;
+  using accumulator_type = Kokkos::Experimental::AtomicAccumulator<
+      long*, DeviceType>;
+  using execution_space = typename DeviceType::execution_space;
+
+  constexpr int n        = 100000;
+  constexpr int num_bins = 1000;
+  view_type bins("bins", num_bins + 2);
+  accumulator_type accumulator(bins, cache_size);
+
+  // several kernels can contribute before the flush
+  for (int kernel = 0; kernel < 2; ++kernel) {
+    Kokkos::parallel_for(Kokkos::RangePolicy<execution_space>(0, n),
+                         HistogramFunctor<accumulator_type>{accumulator,
+                                                            num_bins});
+  }
+  accumulator.flush();
+  // flushing again adds nothing
+  accumulator.flush();
+
+  auto bins_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), bins);
+  ASSERT_EQ(bins_host(0), 2l * n);
+  long cold_sum = 0;
+  for (int bin = 1; bin < num_bins; ++bin) {
+    const long hits = n / (num_bins - 1) + (bin - 1 < n % (num_bins - 1));
+    ASSERT_EQ(bins_host(bin), 4 * hits);
+    cold_sum += bins_host(bin);
+  }
+  ASSERT_EQ(cold_sum, 4l * n);
+  ASSERT_EQ(bins_host(num_bins), -2l * n);
+  ASSERT_EQ(bins_host(num_bins + 1), 2l * n);
+}
+
+TEST(TEST_CATEGORY, atomic_accumulator) {
+  test_atomic_accumulator<TEST_EXECSPACE>(
+      Kokkos::Experimental::AtomicAccumulator<
+          long*, TEST_EXECSPACE>::default_cache_size);
+  test_atomic_accumulator<TEST_EXECSPACE>(1);
+}
+
+}  // namespace Test
+
+#endif  // KOKKOS_TEST_ATOMIC_ACCUMULATOR_HPP
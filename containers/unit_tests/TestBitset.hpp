@@ -243,6 +243,75 @@ void test_bitset() {
 
 TEST(TEST_CATEGORY, bitset) { test_bitset<TEST_EXECSPACE>(); }
 
+template <typename Device>
+void test_bitset_bulk_operations() {
+  using bitset_type = Kokkos::Bitset<Device>;
+
+  const unsigned size = 1000;  // not a multiple of the block size
+
+  bitset_type evens(size);
+  bitset_type thirds(size);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<typename Device::execution_space>(0, size),
+      KOKKOS_LAMBDA(unsigned i) {
+        if (i % 2 == 0) evens.set(i);
+        if (i % 3 == 0) thirds.set(i);
+      });
+
+  auto check = [&](bitset_type const& bitset, auto expected) {
+    typename bitset_type::execution_space().fence();
+    Kokkos::Bitset<Kokkos::HostSpace> host(size);
+    Kokkos::deep_copy(host, bitset);
+    unsigned count = 0;
+    for (unsigned i = 0; i < size; ++i) {
+      ASSERT_EQ(host.test(i), expected(i)) << "bit " << i;
+      count += expected(i);
+    }
+    ASSERT_EQ(bitset.count(), count);
+  };
+
+  bitset_type result(size);
+  Kokkos::deep_copy(result, evens);
+  result.bitwise_and(thirds);
+  check(result, [](unsigned i) { return i % 6 == 0; });
+
+  Kokkos::deep_copy(result, evens);
+  result.bitwise_or(thirds);
+  check(result, [](unsigned i) { return i % 2 == 0 || i % 3 == 0; });
+
+  Kokkos::deep_copy(result, evens);
+  result.bitwise_xor(thirds);
+  check(result, [](unsigned i) { return (i % 2 == 0) != (i % 3 == 0); });
+
+  Kokkos::deep_copy(result, evens);
+  result.bitwise_andnot(thirds);
+  check(result, [](unsigned i) { return i % 2 == 0 && i % 3 != 0; });
+
+  // the set bits of result are 2, 4, 8, 10, 14, 16, ...
+  Kokkos::BitsetRankIndex<Device> index(result);
+  ASSERT_EQ(index.count(), result.count());
+
+  Kokkos::View<unsigned*, Device> list("list", index.count());
+  Kokkos::View<int*, Device> errors("errors", 1);
+  result.for_each_set_bit(
+      "test_bitset_for_each_set_bit", KOKKOS_LAMBDA(unsigned i) {
+        const unsigned r = index.rank(i);
+        list(r)          = i;
+        if (index.select(r) != i) Kokkos::atomic_inc(&errors(0));
+      });
+  auto h_list = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), list);
+  auto h_errors =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), errors);
+  ASSERT_EQ(h_errors(0), 0);
+  for (unsigned k = 0; k < h_list.extent(0); ++k) {
+    ASSERT_EQ(h_list(k), 6 * (k / 2) + 2 * (k % 2) + 2);
+  }
+}
+
+TEST(TEST_CATEGORY, bitset_bulk_operations) {
+  test_bitset_bulk_operations<TEST_EXECSPACE>();
+}
+
 TEST(TEST_CATEGORY, bitset_default_constructor_no_alloc) {
   using namespace Kokkos::Test::Tools;
   listen_tool_events(Config::DisableAll(), Config::EnableAllocs());
@@ -503,6 +503,113 @@ TEST(TEST_CATEGORY, dualview_resize) {
                              /* Initialize */ false>();
 }
 
+TEST(TEST_CATEGORY, dualview_range_sync) {
+  using DualViewType = Kokkos::DualView<int**, Kokkos::LayoutRight,
+                                        TEST_EXECSPACE::device_type>;
+  if constexpr (DualViewType::impl_dualview_is_single_device::value) {
+    GTEST_SKIP() << "host and device views are the same";
+  } else {
+    constexpr int n = 100;
+    constexpr int m = 3;
+    typename DualViewType::t_dev d_view("d_view", n, m);
+    typename DualViewType::t_host h_view("h_view", n, m);
+    DualViewType dv(d_view, h_view);
+
+    Kokkos::deep_copy(h_view, 1);
+    dv.modify_host(10, 20);
+    dv.modify_host(90, 95);
+    dv.modify_host(15, 25);
+    ASSERT_TRUE(dv.need_sync_device());
+    dv.sync_device();
+    ASSERT_FALSE(dv.need_sync_device());
+
+    auto d_mirror =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), d_view);
+    for (int i = 0; i < n; ++i) {
+      const int expected = ((10 <= i && i < 25) || (90 <= i && i < 95));
+      for (int j = 0; j < m; ++j) ASSERT_EQ(d_mirror(i, j), expected);
+    }
+    ASSERT_EQ(dv.bytes_synced(), 20 * m * sizeof(int));
+    ASSERT_EQ(dv.bytes_skipped(), 80 * m * sizeof(int));
+
+    // a whole-View modification overrides the recorded ranges
+    dv.modify_host(0, 1);
+    dv.modify_host();
+    dv.sync_device(TEST_EXECSPACE());
+    TEST_EXECSPACE().fence();
+    Kokkos::deep_copy(d_mirror, d_view);
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < m; ++j) ASSERT_EQ(d_mirror(i, j), 1);
+    ASSERT_EQ(dv.bytes_synced(), (20 + n) * m * sizeof(int));
+
+    // modifying the other side first also requires a full sync
+    dv.reset_sync_statistics();
+    dv.modify_device();
+    dv.modify_host(5, 6);
+    dv.sync_device();
+    ASSERT_EQ(dv.bytes_synced(), n * m * sizeof(int));
+    ASSERT_EQ(dv.bytes_skipped(), 0u);
+
+    // ranges recorded through a subview are not reused by the parent
+    auto sub = Kokkos::subview(dv, Kokkos::make_pair(50, 60), Kokkos::ALL);
+    dv.reset_sync_statistics();
+    sub.modify_host(0, 2);
+    dv.sync_device();
+    ASSERT_EQ(dv.bytes_synced(), n * m * sizeof(int));
+
+    // nor are the ranges of the parent by a leading subview at offset 0
+    auto head = Kokkos::subview(dv, Kokkos::make_pair(0, 5), Kokkos::ALL);
+    dv.reset_sync_statistics();
+    dv.modify_host(50, 60);
+    head.sync_device();
+    ASSERT_EQ(dv.bytes_synced(), 5 * m * sizeof(int));
+  }
+}
+
+// The partial copy of a sync, between a View and a separate mirror of it so
+// that it also runs when host and device memory are the same
+TEST(TEST_CATEGORY, dualview_range_copy) {
+  using view_type = Kokkos::View<int**, Kokkos::LayoutRight, TEST_EXECSPACE>;
+  constexpr int n = 100;
+  constexpr int m = 3;
+  view_type src("src", n, m);
+  auto dst = Kokkos::create_mirror(Kokkos::WithoutInitializing,
+                                   TEST_EXECSPACE::memory_space(), src);
+  Kokkos::deep_copy(src, 1);
+  Kokkos::deep_copy(dst, 0);
+
+  Kokkos::Impl::DualViewModifiedRanges ranges;
+  ranges.record(src);
+  ranges.insert(10, 20);
+  ranges.insert(90, 95);
+  ranges.insert(15, 25);
+  ASSERT_TRUE(ranges.matches(src));
+  ASSERT_FALSE(ranges.matches(
+      Kokkos::subview(src, Kokkos::make_pair(0, 5), Kokkos::ALL)));
+
+  size_t bytes = 0;
+  ASSERT_TRUE(Kokkos::Impl::dual_view_copy_modified_ranges(ranges, dst, src,
+                                                           bytes));
+  ASSERT_EQ(bytes, 20 * m * sizeof(int));
+  auto h_dst = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dst);
+  for (int i = 0; i < n; ++i) {
+    const int expected = ((10 <= i && i < 25) || (90 <= i && i < 95));
+    for (int j = 0; j < m; ++j) ASSERT_EQ(h_dst(i, j), expected);
+  }
+
+  // ranges past the end of the Views, or on non-contiguous subviews, are not
+  // copied
+  const auto rows = Kokkos::make_pair(0, 50);
+  ASSERT_FALSE(Kokkos::Impl::dual_view_copy_modified_ranges(
+      ranges, Kokkos::subview(dst, rows, Kokkos::ALL),
+      Kokkos::subview(src, rows, Kokkos::ALL), bytes));
+  const auto columns = Kokkos::make_pair(0, 2);
+  ASSERT_FALSE(Kokkos::Impl::dual_view_copy_modified_ranges(
+      ranges, Kokkos::subview(dst, Kokkos::ALL, columns),
+      Kokkos::subview(src, Kokkos::ALL, columns), bytes));
+  ASSERT_EQ(bytes, 20 * m * sizeof(int));
+}
+
 namespace {
 /**
  *
@@ -247,6 +247,52 @@ void run_test_graph4() {
                               Kokkos::MemoryUnmanaged>));
 }
 
+template <class Space>
+void run_test_graph_row_policy(size_t B, size_t N) {
+  srand(10310);
+
+  using dView = Kokkos::StaticCrsGraph<int, Space>;
+  using hView = typename dView::HostMirror;
+
+  const unsigned LENGTH = 2000;
+
+  std::vector<size_t> sizes(LENGTH);
+
+  for (size_t i = 0; i < LENGTH; ++i) {
+    sizes[i] = rand() % 100;
+  }
+
+  sizes[1]    = N;
+  sizes[1998] = N;
+  sizes[1999] = 0;
+
+  dView dx = Kokkos::create_staticcrsgraph<dView>("test", sizes);
+
+  // count how often each entry and each row start is visited
+  Kokkos::View<int*, Space> entry_visits("entry_visits", dx.entries.extent(0));
+  Kokkos::View<int*, Space> row_visits("row_visits", LENGTH);
+  auto row_map = dx.row_map;
+
+  Kokkos::Experimental::StaticCrsGraphRowPolicy<dView> policy(dx, B);
+  Kokkos::parallel_for(
+      "test_graph_row_policy", policy,
+      KOKKOS_LAMBDA(const int row, const unsigned begin, const unsigned end) {
+        if (begin == row_map(row)) Kokkos::atomic_inc(&row_visits(row));
+        for (unsigned k = begin; k < end; ++k)
+          Kokkos::atomic_inc(&entry_visits(k));
+      });
+
+  hView hx = Kokkos::create_mirror(dx);
+  auto h_entry_visits =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), entry_visits);
+  auto h_row_visits =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), row_visits);
+
+  for (unsigned i = 0; i < LENGTH; ++i) ASSERT_EQ(h_row_visits(i), 1);
+  for (size_t k = 0; k < hx.entries.extent(0); ++k)
+    ASSERT_EQ(h_entry_visits(k), 1);
+}
+
 } /* namespace TestStaticCrsGraph */
 
 TEST(TEST_CATEGORY, staticcrsgraph) {
@@ -266,4 +312,12 @@ TEST(TEST_CATEGORY, staticcrsgraph) {
   TestStaticCrsGraph::run_test_graph3<TEST_EXECSPACE>(75, 100000);
   TestStaticCrsGraph::run_test_graph4<TEST_EXECSPACE>();
 }
+
+TEST(TEST_CATEGORY, staticcrsgraph_row_policy) {
+  TestStaticCrsGraph::run_test_graph_row_policy<TEST_EXECSPACE>(0, 0);
+  TestStaticCrsGraph::run_test_graph_row_policy<TEST_EXECSPACE>(1, 1000);
+  TestStaticCrsGraph::run_test_graph_row_policy<TEST_EXECSPACE>(7, 10000);
+  TestStaticCrsGraph::run_test_graph_row_policy<TEST_EXECSPACE>(75, 100000);
+  TestStaticCrsGraph::run_test_graph_row_policy<TEST_EXECSPACE>(4000, 10);
+}
 }  // namespace Test
@@ -14,6 +14,11 @@
 //
 //@HEADER
 
+#include "Benchmark_Context.hpp"
+
+#include <iostream>
+#include <type_traits>
+
 namespace Test {
 template <class DeviceType, typename ScalarType = double,
           typename TestLayout = Kokkos::LayoutRight>
@@ -596,3 +601,72 @@ struct RangePolicyCollapseAll {
 };
 
 }  // end namespace Test
+
+namespace Test {
+
+template <class T, int Rank>
+struct MDRangeDataType {
+  using type = typename MDRangeDataType<T*, Rank - 1>::type;
+};
+
+template <class T>
+struct MDRangeDataType<T, 0> {
+  using type = T;
+};
+
+template <int Rank, class Layout>
+struct MDRangeAxpy {
+  using view_type = Kokkos::View<typename MDRangeDataType<double, Rank>::type,
+                                 Layout, Kokkos::HostSpace>;
+
+  view_type x;
+  view_type y;
+
+  template <class... Idx>
+  KOKKOS_FUNCTION void operator()(Idx... i) const {
+    y(i...) += 2.0 * x(i...);
+  }
+};
+
+// y += 2 x over a rank Rank View with extent state.range(0) in every
+// dimension, iterated by the host backend in cubic tiles of size
+// state.range(1).  The iteration order matches the layout of the Views.
+template <int Rank, class Layout>
+static void MDRange_Axpy(benchmark::State& state) {
+  constexpr Kokkos::Iterate iter = std::is_same_v<Layout, Kokkos::LayoutLeft>
+                                       ? Kokkos::Iterate::Left
+                                       : Kokkos::Iterate::Right;
+  using policy_type =
+      Kokkos::MDRangePolicy<Kokkos::DefaultHostExecutionSpace,
+                            Kokkos::Rank<Rank, iter, iter>>;
+  using view_type = typename MDRangeAxpy<Rank, Layout>::view_type;
+
+  const int n    = state.range(0);
+  const int tile = state.range(1);
+
+  typename policy_type::point_type lower;
+  typename policy_type::point_type upper;
+  typename policy_type::tile_type tiles;
+  Layout layout;
+  for (int r = 0; r < Rank; ++r) {
+    lower[r]            = 0;
+    upper[r]            = n;
+    tiles[r]            = tile;
+    layout.dimension[r] = n;
+  }
+
+  MDRangeAxpy<Rank, Layout> functor{view_type("x", layout),
+                                    view_type("y", layout)};
+  Kokkos::deep_copy(functor.x, 1.0);
+  const policy_type policy(lower, upper, tiles);
+
+  for (auto _ : state) {
+    Kokkos::fence();
+    Kokkos::Timer timer;
+    Kokkos::parallel_for("MDRange_Axpy", policy, functor);
+    Kokkos::fence();
+    KokkosBenchmark::report_results(state, functor.x, 3, timer.seconds());
+  }
+}
+
+}  // namespace Test
@@ -0,0 +1,64 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+#include "Benchmark_Context.hpp"
+
+namespace Benchmark {
+
+// Histogram of the indices, the reduction result is an array of value_count
+// bins that has to be joined across all the threads
+struct ArrayReductionFunctor {
+  using value_type = double[];
+
+  const int value_count;
+
+  ArrayReductionFunctor(const int count) : value_count(count) {}
+
+  KOKKOS_FUNCTION void operator()(const int i, value_type update) const {
+    update[i % value_count] += 1.0;
+  }
+};
+
+template <class ExecSpace>
+static void ArrayReduction(benchmark::State& state) {
+  const int value_count = state.range(0);
+  // at least a few updates per value, the join dominates for large counts
+  const int N = 4 * value_count < (1 << 20) ? 1 << 20 : 4 * value_count;
+
+  Kokkos::View<double*, Kokkos::HostSpace> result("result", value_count);
+  for (auto _ : state) {
+    Kokkos::Timer timer;
+    Kokkos::parallel_reduce("ArrayReduction",
+                            Kokkos::RangePolicy<ExecSpace>(0, N),
+                            ArrayReductionFunctor(value_count), result);
+    state.SetIterationTime(timer.seconds());
+  }
+
+  state.counters["value_count"] = value_count;
+  state.counters[KokkosBenchmark::benchmark_fom("rate")] =
+      benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(ArrayReduction<Kokkos::DefaultHostExecutionSpace>)
+    ->ArgName("value_count")
+    ->RangeMultiplier(4)
+    ->Range(1, 1 << 16)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace Benchmark
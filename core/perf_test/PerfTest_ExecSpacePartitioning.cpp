@@ -18,6 +18,8 @@
 #include <benchmark/benchmark.h>
 #include "PerfTest_Category.hpp"
 
+#include <thread>
+
 namespace Test {
 
 namespace {
@@ -62,6 +64,35 @@ bool is_overlapping<Kokkos::SYCL>(const Kokkos::SYCL&) {
 #endif
 #endif
 
+// Whether a launch returns before the kernel completed
+template <class ExecutionSpace>
+bool is_asynchronous(const ExecutionSpace& space) {
+  return is_overlapping(space);
+}
+
+// Whether kernels launched on the instances returned by partition_space run
+// at the same time
+template <class ExecutionSpace>
+bool runs_partitions_concurrently(const ExecutionSpace& space) {
+  return is_overlapping(space);
+}
+
+#if defined(KOKKOS_ENABLE_OPENMP) && \
+    defined(KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH)
+template <>
+bool is_asynchronous<Kokkos::OpenMP>(const Kokkos::OpenMP&) {
+  return true;
+}
+
+// The partitions only run at the same time on threads of their own, which
+// need cores of their own to be faster than running one after the other
+template <>
+bool runs_partitions_concurrently<Kokkos::OpenMP>(const Kokkos::OpenMP& space) {
+  const int cores = std::thread::hardware_concurrency();
+  return space.concurrency() > 1 && space.concurrency() <= cores;
+}
+#endif
+
 }  // namespace
 
 struct FunctorRange {
@@ -236,8 +267,31 @@ static void OverlapRangePolicy(benchmark::State& state) {
     if (is_overlapping(space)) {
       KOKKOS_ASSERT(time_end > 1.5 * time_overlap);
     }
+
+    // the same kernels on the partitions, one after the other
+    timer.reset();
+    Kokkos::parallel_for(
+        "default_exec::overlap_range_policy::kernel5",
+        Kokkos::Experimental::require(
+            Kokkos::RangePolicy<TEST_EXECSPACE>(space1, 0, N),
+            Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+        FunctorRange(M, R, a));
+    space1.fence();
+    Kokkos::parallel_for(
+        "default_exec::overlap_range_policy::kernel6",
+        Kokkos::Experimental::require(
+            Kokkos::RangePolicy<TEST_EXECSPACE>(space2, 0, N),
+            Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+        FunctorRange(M, R, a));
+    space2.fence();
+    double time_serialized = timer.seconds();
+
+    if (runs_partitions_concurrently(space)) {
+      KOKKOS_ASSERT(time_serialized > 1.5 * time_overlap);
+    }
     state.counters["Time NonOverlap"] = benchmark::Counter(time_end);
     state.counters["Time Overlap"]    = benchmark::Counter(time_overlap);
+    state.counters["Time Serialized"] = benchmark::Counter(time_serialized);
 
     Kokkos::View<double, TEST_EXECSPACE> result("result");
     Kokkos::View<double, TEST_EXECSPACE> result1("result1");
@@ -266,7 +320,7 @@ static void OverlapRangePolicy(benchmark::State& state) {
         fr, result);
     double time_not_fenced = timer.seconds();
     Kokkos::fence();
-    if (is_overlapping(space)) {
+    if (is_asynchronous(space)) {
       KOKKOS_ASSERT(time_fenced > 2.0 * time_not_fenced);
     }
 
@@ -311,7 +365,7 @@ static void OverlapRangePolicy(benchmark::State& state) {
     KOKKOS_ASSERT(h_result1() == h_result());
     KOKKOS_ASSERT(h_result2() == h_result());
 
-    if (is_overlapping(space)) {
+    if (runs_partitions_concurrently(space)) {
       KOKKOS_ASSERT(time_overlapped_reduce < 1.5 * time_no_overlapped_reduce);
     }
 
@@ -422,8 +476,33 @@ static void OverlapMDRangePolicy(benchmark::State& state) {
       KOKKOS_ASSERT(time_end > 1.5 * time_overlap);
     }
 
+    // the same kernels on the partitions, one after the other
+    timer.reset();
+    Kokkos::parallel_for(
+        "default_exec::overlap_range_policy::kernel5",
+        Kokkos::Experimental::require(
+            Kokkos::MDRangePolicy<TEST_EXECSPACE, Kokkos::Rank<2>>(
+                space1, {0, 0}, {N, R}),
+            Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+        FunctorMDRange(M, R, a));
+    space1.fence();
+    Kokkos::parallel_for(
+        "default_exec::overlap_range_policy::kernel6",
+        Kokkos::Experimental::require(
+            Kokkos::MDRangePolicy<TEST_EXECSPACE, Kokkos::Rank<2>>(
+                space2, {0, 0}, {N, R}),
+            Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+        FunctorMDRange(M, R, a));
+    space2.fence();
+    double time_serialized = timer.seconds();
+
+    if (runs_partitions_concurrently(space)) {
+      KOKKOS_ASSERT(time_serialized > 1.5 * time_overlap);
+    }
+
     state.counters["Time NonOverlap"] = benchmark::Counter(time_end);
     state.counters["Time Overlap"]    = benchmark::Counter(time_overlap);
+    state.counters["Time Serialized"] = benchmark::Counter(time_serialized);
 
     Kokkos::View<double, TEST_EXECSPACE> result("result");
     Kokkos::View<double, TEST_EXECSPACE> result1("result1");
@@ -454,7 +533,7 @@ static void OverlapMDRangePolicy(benchmark::State& state) {
         fr, result);
     double time_not_fenced = timer.seconds();
     Kokkos::fence();
-    if (is_overlapping(space)) {
+    if (is_asynchronous(space)) {
       KOKKOS_ASSERT(time_fenced > 2.0 * time_not_fenced);
     }
 
@@ -503,7 +582,7 @@ static void OverlapMDRangePolicy(benchmark::State& state) {
     KOKKOS_ASSERT(h_result1() == h_result());
     KOKKOS_ASSERT(h_result2() == h_result());
 
-    if (is_overlapping(space)) {
+    if (runs_partitions_concurrently(space)) {
       KOKKOS_ASSERT(time_overlapped_reduce < 1.5 * time_no_overlapped_reduce);
     }
 
@@ -605,8 +684,31 @@ static void OverlapTeamPolicy(benchmark::State& state) {
       KOKKOS_ASSERT(time_end > 1.5 * time_overlap);
     }
 
+    // the same kernels on the partitions, one after the other
+    timer.reset();
+    Kokkos::parallel_for(
+        "default_exec::overlap_range_policy::kernel5",
+        Kokkos::Experimental::require(
+            Kokkos::TeamPolicy<TEST_EXECSPACE>(space1, N, Kokkos::AUTO),
+            Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+        FunctorTeam(M, R, a));
+    space1.fence();
+    Kokkos::parallel_for(
+        "default_exec::overlap_range_policy::kernel6",
+        Kokkos::Experimental::require(
+            Kokkos::TeamPolicy<TEST_EXECSPACE>(space2, N, Kokkos::AUTO),
+            Kokkos::Experimental::WorkItemProperty::HintLightWeight),
+        FunctorTeam(M, R, a));
+    space2.fence();
+    double time_serialized = timer.seconds();
+
+    if (runs_partitions_concurrently(space)) {
+      KOKKOS_ASSERT(time_serialized > 1.5 * time_overlap);
+    }
+
     state.counters["Time NonOverlap"] = benchmark::Counter(time_end);
     state.counters["Time Overlap"]    = benchmark::Counter(time_overlap);
+    state.counters["Time Serialized"] = benchmark::Counter(time_serialized);
 
     Kokkos::View<double, TEST_EXECSPACE> result("result");
     Kokkos::View<double, TEST_EXECSPACE> result1("result1");
@@ -635,7 +737,7 @@ static void OverlapTeamPolicy(benchmark::State& state) {
         fr, result);
     double time_not_fenced = timer.seconds();
     Kokkos::fence();
-    if (is_overlapping(space)) {
+    if (is_asynchronous(space)) {
       KOKKOS_ASSERT(time_fenced > 2.0 * time_not_fenced);
     }
 
@@ -680,7 +782,7 @@ static void OverlapTeamPolicy(benchmark::State& state) {
     KOKKOS_ASSERT(h_result1() == h_result());
     KOKKOS_ASSERT(h_result2() == h_result());
 
-    if (is_overlapping(space)) {
+    if (runs_partitions_concurrently(space)) {
       KOKKOS_ASSERT(time_overlapped_reduce < 1.5 * time_no_overlapped_reduce);
     }
 
@@ -0,0 +1,85 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include "PerfTestMDRange.hpp"
+
+namespace Test {
+
+// The second extent of each pair is not a multiple of the tile size so that
+// the benchmark covers partial tiles.
+
+BENCHMARK(MDRange_Axpy<2, Kokkos::LayoutLeft>)
+    ->ArgNames({"N", "tile"})
+    ->Args({2048, 64})
+    ->Args({2051, 64})
+    ->UseManualTime();
+
+BENCHMARK(MDRange_Axpy<2, Kokkos::LayoutRight>)
+    ->ArgNames({"N", "tile"})
+    ->Args({2048, 64})
+    ->Args({2051, 64})
+    ->UseManualTime();
+
+BENCHMARK(MDRange_Axpy<3, Kokkos::LayoutLeft>)
+    ->ArgNames({"N", "tile"})
+    ->Args({160, 16})
+    ->Args({163, 16})
+    ->UseManualTime();
+
+BENCHMARK(MDRange_Axpy<3, Kokkos::LayoutRight>)
+    ->ArgNames({"N", "tile"})
+    ->Args({160, 16})
+    ->Args({163, 16})
+    ->UseManualTime();
+
+BENCHMARK(MDRange_Axpy<4, Kokkos::LayoutLeft>)
+    ->ArgNames({"N", "tile"})
+    ->Args({40, 8})
+    ->Args({43, 8})
+    ->UseManualTime();
+
+BENCHMARK(MDRange_Axpy<4, Kokkos::LayoutRight>)
+    ->ArgNames({"N", "tile"})
+    ->Args({40, 8})
+    ->Args({43, 8})
+    ->UseManualTime();
+
+BENCHMARK(MDRange_Axpy<5, Kokkos::LayoutLeft>)
+    ->ArgNames({"N", "tile"})
+    ->Args({16, 4})
+    ->Args({19, 4})
+    ->UseManualTime();
+
+BENCHMARK(MDRange_Axpy<5, Kokkos::LayoutRight>)
+    ->ArgNames({"N", "tile"})
+    ->Args({16, 4})
+    ->Args({19, 4})
+    ->UseManualTime();
+
+BENCHMARK(MDRange_Axpy<6, Kokkos::LayoutLeft>)
+    ->ArgNames({"N", "tile"})
+    ->Args({10, 4})
+    ->Args({11, 4})
+    ->UseManualTime();
+
+BENCHMARK(MDRange_Axpy<6, Kokkos::LayoutRight>)
+    ->ArgNames({"N", "tile"})
+    ->Args({10, 4})
+    ->Args({11, 4})
+    ->UseManualTime();
+
+}  // namespace Test
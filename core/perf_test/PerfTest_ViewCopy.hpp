@@ -28,12 +28,24 @@ namespace Test {
 
 static constexpr int DATA_RATIO = 2;
 
-template <class ViewTypeA, class ViewTypeB>
+// With Generic, copy with the ViewCopy functors that deep_copy uses unless
+// the views are copied as a blocked transpose on the host
+template <bool Generic = false, class ViewTypeA, class ViewTypeB>
 void deepcopy_view(ViewTypeA& a, ViewTypeB& b, benchmark::State& state) {
+  using exec_space = typename ViewTypeA::execution_space;
   for (auto _ : state) {
     Kokkos::fence();
     Kokkos::Timer timer;
-    Kokkos::deep_copy(a, b);
+    if constexpr (Generic) {
+      Kokkos::Impl::ViewCopy<
+          typename ViewTypeA::uniform_runtime_nomemspace_type,
+          typename ViewTypeB::uniform_runtime_const_nomemspace_type,
+          typename ViewTypeA::array_layout, exec_space, ViewTypeA::rank, int>(
+          a, b);
+      Kokkos::fence();
+    } else {
+      Kokkos::deep_copy(a, b);
+    }
     KokkosBenchmark::report_results(state, a, DATA_RATIO, timer.seconds());
   }
 }
@@ -48,7 +60,7 @@ static void ViewDeepCopy_Rank1(benchmark::State& state) {
   deepcopy_view(a, b, state);
 }
 
-template <class LayoutA, class LayoutB>
+template <class LayoutA, class LayoutB, bool Generic = false>
 static void ViewDeepCopy_Rank2(benchmark::State& state) {
   const int N1 = state.range(0);
   const int N2 = N1 * N1;
@@ -57,10 +69,10 @@ static void ViewDeepCopy_Rank2(benchmark::State& state) {
   Kokkos::View<double**, LayoutA> a("A2", N4, N4);
   Kokkos::View<double**, LayoutB> b("B2", N4, N4);
 
-  deepcopy_view(a, b, state);
+  deepcopy_view<Generic>(a, b, state);
 }
 
-template <class LayoutA, class LayoutB>
+template <class LayoutA, class LayoutB, bool Generic = false>
 static void ViewDeepCopy_Rank3(benchmark::State& state) {
   const int N1 = state.range(0);
   const int N2 = N1 * N1;
@@ -69,10 +81,10 @@ static void ViewDeepCopy_Rank3(benchmark::State& state) {
   Kokkos::View<double***, LayoutA> a("A3", N3, N3, N2);
   Kokkos::View<double***, LayoutB> b("B3", N3, N3, N2);
 
-  deepcopy_view(a, b, state);
+  deepcopy_view<Generic>(a, b, state);
 }
 
-template <class LayoutA, class LayoutB>
+template <class LayoutA, class LayoutB, bool Generic = false>
 static void ViewDeepCopy_Rank4(benchmark::State& state) {
   const int N1 = state.range(0);
   const int N2 = N1 * N1;
@@ -80,10 +92,10 @@ static void ViewDeepCopy_Rank4(benchmark::State& state) {
   Kokkos::View<double****, LayoutA> a("A4", N2, N2, N2, N2);
   Kokkos::View<double****, LayoutB> b("B4", N2, N2, N2, N2);
 
-  deepcopy_view(a, b, state);
+  deepcopy_view<Generic>(a, b, state);
 }
 
-template <class LayoutA, class LayoutB>
+template <class LayoutA, class LayoutB, bool Generic = false>
 static void ViewDeepCopy_Rank5(benchmark::State& state) {
   const int N1 = state.range(0);
   const int N2 = N1 * N1;
@@ -91,10 +103,10 @@ static void ViewDeepCopy_Rank5(benchmark::State& state) {
   Kokkos::View<double*****, LayoutA> a("A5", N2, N2, N1, N1, N2);
   Kokkos::View<double*****, LayoutB> b("B5", N2, N2, N1, N1, N2);
 
-  deepcopy_view(a, b, state);
+  deepcopy_view<Generic>(a, b, state);
 }
 
-template <class LayoutA, class LayoutB>
+template <class LayoutA, class LayoutB, bool Generic = false>
 static void ViewDeepCopy_Rank6(benchmark::State& state) {
   const int N1 = state.range(0);
   const int N2 = N1 * N1;
@@ -102,10 +114,10 @@ static void ViewDeepCopy_Rank6(benchmark::State& state) {
   Kokkos::View<double******, LayoutA> a("A6", N2, N1, N1, N1, N1, N2);
   Kokkos::View<double******, LayoutB> b("B6", N2, N1, N1, N1, N1, N2);
 
-  deepcopy_view(a, b, state);
+  deepcopy_view<Generic>(a, b, state);
 }
 
-template <class LayoutA, class LayoutB>
+template <class LayoutA, class LayoutB, bool Generic = false>
 static void ViewDeepCopy_Rank7(benchmark::State& state) {
   const int N1 = state.range(0);
   const int N2 = N1 * N1;
@@ -113,17 +125,17 @@ static void ViewDeepCopy_Rank7(benchmark::State& state) {
   Kokkos::View<double*******, LayoutA> a("A7", N2, N1, N1, N1, N1, N1, N1);
   Kokkos::View<double*******, LayoutB> b("B7", N2, N1, N1, N1, N1, N1, N1);
 
-  deepcopy_view(a, b, state);
+  deepcopy_view<Generic>(a, b, state);
 }
 
-template <class LayoutA, class LayoutB>
+template <class LayoutA, class LayoutB, bool Generic = false>
 static void ViewDeepCopy_Rank8(benchmark::State& state) {
   const int N1 = state.range(0);
 
   Kokkos::View<double********, LayoutA> a("A8", N1, N1, N1, N1, N1, N1, N1, N1);
   Kokkos::View<double********, LayoutB> b("B8", N1, N1, N1, N1, N1, N1, N1, N1);
 
-  deepcopy_view(a, b, state);
+  deepcopy_view<Generic>(a, b, state);
 }
 
 template <class LayoutA, class LayoutB>
@@ -284,6 +284,25 @@ static void ViewResize_NoInit_Rank8(benchmark::State& state) {
   }
 }
 
+// Grow a View by 5% ten times, as done for particle arrays.  HostSpace Views
+// keep a capacity so that most of these resizes do not copy.
+template <class Layout>
+static void ViewResize_Grow_Rank1(benchmark::State& state) {
+  const int N8 = std::pow(state.range(0), 8);
+  Kokkos::View<double*, Layout> a("A1", N8);
+
+  for (auto _ : state) {
+    Kokkos::View<double*, Layout> a_("A1", N8);
+    Kokkos::fence();
+    Kokkos::Timer timer;
+    for (int step = 1; step <= 10; ++step) {
+      Kokkos::resize(a_, int(N8 * (1 + 0.05 * step)));
+    }
+    Kokkos::fence();
+    KokkosBenchmark::report_results(state, a, 2, timer.seconds());
+  }
+}
+
 template <class Layout>
 static void ViewResize_NoInit_Raw(benchmark::State& state) {
   const int N8 = std::pow(state.range(0), 8);
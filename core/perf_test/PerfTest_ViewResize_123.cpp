@@ -54,6 +54,18 @@ BENCHMARK(ViewResize_Rank3<Kokkos::LayoutRight>)
     ->UseManualTime()
     ->Iterations(R);
 
+BENCHMARK(ViewResize_Grow_Rank1<Kokkos::LayoutLeft>)
+    ->ArgName("N")
+    ->Arg(N)
+    ->UseManualTime()
+    ->Iterations(R);
+
+BENCHMARK(ViewResize_Grow_Rank1<Kokkos::LayoutRight>)
+    ->ArgName("N")
+    ->Arg(N)
+    ->UseManualTime()
+    ->Iterations(R);
+
 BENCHMARK(ViewResize_NoInit_Rank1<Kokkos::LayoutLeft>)
     ->ArgName("N")
     ->Arg(N)
@@ -159,6 +159,7 @@ void HPX::impl_instance_fence_locked(const std::string &name) const {
 }
 
 void HPX::impl_instance_fence(const std::string &name) const {
+  Kokkos::Impl::graph_capture_fence(*this);
   std::lock_guard<hpx::spinlock> l(impl_get_sender_mutex());
   impl_instance_fence_locked(name);
 }
@@ -18,6 +18,7 @@
 #define KOKKOS_HPX_WORKGRAPHPOLICY_HPP
 
 #include <HPX/Kokkos_HPX.hpp>
+#include <impl/Kokkos_HostWorkGraphQueue.hpp>
 
 #include <hpx/execution.hpp>
 
@@ -33,29 +34,27 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
 
   Policy m_policy;
   FunctorType m_functor;
+  HostWorkGraphQueue<Policy>* m_queue = nullptr;
 
  public:
-  void execute_range(int) const {
-    std::int32_t w = m_policy.pop_work();
-    while (w != Policy::COMPLETED_TOKEN) {
-      if (w != Policy::END_TOKEN) {
-        if constexpr (std::is_same_v<WorkTag, void>) {
-          m_functor(w);
-        } else {
-          m_functor(WorkTag{}, w);
-        }
-        m_policy.completed_work(w);
+  void execute_range(int rank) const {
+    m_queue->execute(rank, [this](const std::int32_t w) {
+      if constexpr (std::is_same_v<WorkTag, void>) {
+        m_functor(w);
+      } else {
+        m_functor(WorkTag{}, w);
       }
-
-      w = m_policy.pop_work();
-    }
+    });
   }
 
-  void execute() const {
+  void execute() {
     const int num_worker_threads = Kokkos::Experimental::HPX().concurrency();
+    HostWorkGraphQueue<Policy> queue(m_policy, num_worker_threads);
+    m_queue = &queue;
     Kokkos::Experimental::HPX().impl_bulk_plain(
         true, is_light_weight_policy<Policy>(), *this, num_worker_threads,
         hpx::threads::thread_stacksize::nostack);
+    m_queue = nullptr;
   }
 
   inline ParallelFor(const FunctorType &arg_functor, const Policy &arg_policy)
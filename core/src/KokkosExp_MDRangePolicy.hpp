@@ -370,6 +370,7 @@ struct MDRangePolicy<P, Properties...>
   }
 
   void init_helper(Impl::TileSizeProperties properties) {
+    m_num_tiles      = 1;
     m_prod_tile_dims = 1;
     int increment    = 1;
     int rank_start   = 0;
@@ -476,6 +477,51 @@ template <typename ES, typename T, size_t N, size_t NT,
 MDRangePolicy(ES const&, Array<T, N> const&, Array<T, N> const&,
               Array<T, NT> const&) -> MDRangePolicy<ES, Rank<N>>;
 
+namespace Experimental {
+
+/// \brief MDRangePolicy over all the indices of a View with a LayoutTiled,
+///   whose tiles coincide with the tiles of the layout.
+///
+/// The tiles are iterated over in the order in which the layout stores them
+/// and each tile of the iteration accesses a single contiguous tile of the
+/// View. The tiles of a subview only coincide with the tiles of the layout if
+/// the origin of the subview is a multiple of the tile extents.
+///
+/// deep_copy uses such a policy whenever it fills or copies a View with
+/// LayoutTiled. An MDRangePolicy built from bounds alone keeps its default
+/// tiles: it does not know which Views the functor accesses, so kernels over
+/// tiled Views should be launched with this policy instead.
+template <class... Properties, class ExecutionSpace, class ViewType>
+auto tile_aligned_policy(const ExecutionSpace& space, const ViewType& view) {
+  using layout = typename ViewType::array_layout;
+  static_assert(Impl::is_layout_tiled_v<layout>,
+                "tile_aligned_policy requires a View with LayoutTiled");
+
+  using iterate_type =
+      Rank<layout::rank,
+           Impl::layout_iterate_type_selector<layout>::outer_iteration_pattern,
+           layout::inner_pattern>;
+  using policy_type =
+      MDRangePolicy<ExecutionSpace, iterate_type, Properties...>;
+
+  typename policy_type::point_type lower{};
+  typename policy_type::point_type upper{};
+  typename policy_type::tile_type tile{};
+  for (unsigned r = 0; r < layout::rank; ++r) {
+    upper[r] = view.extent(r);
+    tile[r]  = layout::tile_extent(r);
+  }
+  return policy_type(space, lower, upper, tile);
+}
+
+template <class... Properties, class ViewType>
+auto tile_aligned_policy(const ViewType& view) {
+  return tile_aligned_policy<Properties...>(
+      typename ViewType::execution_space(), view);
+}
+
+}  // namespace Experimental
+
 }  // namespace Kokkos
 
 #endif  // KOKKOS_CORE_EXP_MD_RANGE_POLICY_HPP
@@ -103,6 +103,30 @@ inline constexpr bool operator==(WorkItemProperty::ImplWorkItemProperty<pv1>,
   return pv1 == pv2;
 }
 
+/**\brief Request reduction results that do not depend on the number of
+ *         threads nor on the schedule.
+ *
+ *  The iteration range is reduced in blocks whose size only depends on the
+ *  range and on an explicitly set chunk size, and the block results are
+ *  combined in a fixed order. Only honored by RangePolicy reductions on the
+ *  Serial, OpenMP and Threads backends, any other use fails to compile.
+ */
+struct Reproducible {
+  using reproducible = Reproducible;
+};
+
+/**\brief Declare that iteration i of a RangePolicy parallel_for graph node
+ *         only depends on iteration i of the node it follows.
+ *
+ *  A chain of such nodes with identical bounds on the same execution space
+ *  instance may be fused by the host graph implementation into a single
+ *  parallel region, which runs blocks of iterations through every kernel of
+ *  the chain in turn.
+ */
+struct Elementwise {
+  using elementwise = Elementwise;
+};
+
 }  // namespace Experimental
 
 /**\brief Specify Launch Bounds for CUDA execution.
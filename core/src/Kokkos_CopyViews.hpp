@@ -21,6 +21,8 @@ static_assert(false,
 #endif
 #ifndef KOKKOS_COPYVIEWS_HPP_
 #define KOKKOS_COPYVIEWS_HPP_
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <sstream>
 #include <Kokkos_Parallel.hpp>
@@ -48,6 +50,13 @@ struct ViewFillLayoutSelector<Kokkos::LayoutRight> {
   static const Kokkos::Iterate iterate = Kokkos::Iterate::Right;
 };
 
+template <Experimental::TileOrder OuterP, Kokkos::Iterate InnerP,
+          unsigned ArgN0, unsigned ArgN1, unsigned ArgN2>
+struct ViewFillLayoutSelector<
+    Experimental::LayoutTiled<OuterP, InnerP, ArgN0, ArgN1, ArgN2>> {
+  static const Kokkos::Iterate iterate = InnerP;
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -93,9 +102,18 @@ struct ViewFill<ViewType, Layout, ExecSpace, 2, iType> {
   ViewFill(const ViewType& a_, typename ViewType::const_value_type& val_,
            const ExecSpace& space)
       : a(a_), val(val_) {
-    Kokkos::parallel_for("Kokkos::ViewFill-2D",
-                         policy_type(space, {0, 0}, {a.extent(0), a.extent(1)}),
-                         *this);
+    if constexpr (is_layout_tiled_v<typename ViewType::array_layout>) {
+      // each tile of the iteration fills a single contiguous tile of the View
+      Kokkos::parallel_for(
+          "Kokkos::ViewFill-2D",
+          Experimental::tile_aligned_policy<Kokkos::IndexType<iType>>(space,
+                                                                      a),
+          *this);
+    } else {
+      Kokkos::parallel_for(
+          "Kokkos::ViewFill-2D",
+          policy_type(space, {0, 0}, {a.extent(0), a.extent(1)}), *this);
+    }
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -115,10 +133,19 @@ struct ViewFill<ViewType, Layout, ExecSpace, 3, iType> {
   ViewFill(const ViewType& a_, typename ViewType::const_value_type& val_,
            const ExecSpace& space)
       : a(a_), val(val_) {
-    Kokkos::parallel_for(
-        "Kokkos::ViewFill-3D",
-        policy_type(space, {0, 0, 0}, {a.extent(0), a.extent(1), a.extent(2)}),
-        *this);
+    if constexpr (is_layout_tiled_v<typename ViewType::array_layout>) {
+      // each tile of the iteration fills a single contiguous tile of the View
+      Kokkos::parallel_for(
+          "Kokkos::ViewFill-3D",
+          Experimental::tile_aligned_policy<Kokkos::IndexType<iType>>(space,
+                                                                      a),
+          *this);
+    } else {
+      Kokkos::parallel_for("Kokkos::ViewFill-3D",
+                           policy_type(space, {0, 0, 0},
+                                       {a.extent(0), a.extent(1), a.extent(2)}),
+                           *this);
+    }
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -532,6 +559,232 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 8, iType> {
   };
 };
 
+/** \brief Copy between host views whose fastest running dimensions differ,
+ *         e.g. between a LayoutLeft and a LayoutRight view.
+ *
+ *  ViewCopy iterates in the order of the destination, so that consecutive
+ *  values read from the source are far apart. Here the fastest running
+ *  dimensions of both views are split into tiles small enough to stay in
+ *  cache and each tile is copied as a blocked transpose. The remaining
+ *  dimensions are iterated over outside of the tiles.
+ */
+template <class DstType, class SrcType, class ExecSpace>
+struct ViewCopyTranspose {
+  static constexpr int rank = DstType::rank;
+
+  using dst_value_type = typename DstType::value_type;
+  using src_value_type = typename SrcType::const_value_type;
+  using policy_type =
+      Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<int64_t>>;
+
+  // Edge of the tiles, the tiles of both views fit into the L1 cache
+  static constexpr int64_t tile_size = sizeof(dst_value_type) <= 4 ? 64 : 32;
+  // Edge of the blocks copied with a fixed number of iterations, which lets
+  // the compiler vectorize the transpose of a block with shuffles
+  static constexpr int64_t block_size = 8;
+
+  static constexpr bool is_supported_type =
+      rank >= 2 && SpaceAccessibility<ExecSpace, HostSpace>::accessible &&
+      SpaceAccessibility<ExecSpace,
+                         typename DstType::memory_space>::accessible &&
+      SpaceAccessibility<ExecSpace,
+                         typename SrcType::memory_space>::accessible &&
+      std::is_lvalue_reference_v<typename DstType::reference_type> &&
+      std::is_lvalue_reference_v<typename SrcType::reference_type> &&
+      !is_layout_tiled_v<typename DstType::array_layout> &&
+      !is_layout_tiled_v<typename SrcType::array_layout>;
+
+  dst_value_type* m_dst;
+  src_value_type* m_src;
+  int64_t m_extent[rank];
+  int64_t m_dst_stride[rank];
+  int64_t m_src_stride[rank];
+  int m_dst_dim;
+  int m_src_dim;
+  int64_t m_dst_tiles;
+  int64_t m_src_tiles;
+
+  template <class ViewType>
+  static int fastest_dimension(const ViewType& view) {
+    int fastest = -1;
+    for (int r = 0; r < rank; ++r) {
+      if (view.extent(r) > 1 &&
+          (fastest < 0 || view.stride(r) < view.stride(fastest))) {
+        fastest = r;
+      }
+    }
+    return fastest;
+  }
+
+  // Whether the views are large enough and their fastest running dimensions
+  // differ, otherwise ViewCopy already has contiguous accesses to both
+  static bool is_applicable(const DstType& dst, const SrcType& src) {
+    if (dst.size() < size_t(tile_size * tile_size)) return false;
+    const int dst_dim = fastest_dimension(dst);
+    const int src_dim = fastest_dimension(src);
+    return dst_dim >= 0 && src_dim >= 0 && dst_dim != src_dim;
+  }
+
+  ViewCopyTranspose(const DstType& dst, const SrcType& src,
+                    const ExecSpace& space)
+      : m_dst(dst.data()),
+        m_src(src.data()),
+        m_dst_dim(fastest_dimension(dst)),
+        m_src_dim(fastest_dimension(src)) {
+    int64_t work = 1;
+    for (int r = 0; r < rank; ++r) {
+      m_extent[r]     = dst.extent(r);
+      m_dst_stride[r] = dst.stride(r);
+      m_src_stride[r] = src.stride(r);
+      if (r != m_dst_dim && r != m_src_dim) work *= m_extent[r];
+    }
+    m_dst_tiles = (m_extent[m_dst_dim] + tile_size - 1) / tile_size;
+    m_src_tiles = (m_extent[m_src_dim] + tile_size - 1) / tile_size;
+    work *= m_dst_tiles * m_src_tiles;
+    Kokkos::parallel_for("Kokkos::ViewCopy-Transpose",
+                         policy_type(space, 0, work), *this);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int64_t work) const {
+    const int64_t src_tile = work % m_src_tiles;
+    work /= m_src_tiles;
+    const int64_t dst_tile = work % m_dst_tiles;
+    work /= m_dst_tiles;
+
+    dst_value_type* dst       = m_dst;
+    const src_value_type* src = m_src;
+    for (int r = rank - 1; r >= 0; --r) {
+      if (r == m_dst_dim || r == m_src_dim) continue;
+      const int64_t i = work % m_extent[r];
+      work /= m_extent[r];
+      dst += i * m_dst_stride[r];
+      src += i * m_src_stride[r];
+    }
+
+    // i runs along the fastest dimension of the destination and j along the
+    // fastest dimension of the source
+    const int64_t i_begin = dst_tile * tile_size;
+    const int64_t j_begin = src_tile * tile_size;
+    const int64_t i_end = Kokkos::min(i_begin + tile_size, m_extent[m_dst_dim]);
+    const int64_t j_end = Kokkos::min(j_begin + tile_size, m_extent[m_src_dim]);
+    const int64_t dst_i = m_dst_stride[m_dst_dim];
+    const int64_t dst_j = m_dst_stride[m_src_dim];
+    const int64_t src_i = m_src_stride[m_dst_dim];
+    const int64_t src_j = m_src_stride[m_src_dim];
+
+    if (dst_i == 1 && src_j == 1) {
+      const int64_t i_blocked = i_end - (i_end - i_begin) % block_size;
+      const int64_t j_blocked = j_end - (j_end - j_begin) % block_size;
+      for (int64_t j = j_begin; j < j_blocked; j += block_size) {
+        for (int64_t i = i_begin; i < i_blocked; i += block_size) {
+          copy_block(dst + i + j * dst_j, dst_j, src + i * src_i + j, src_i);
+        }
+      }
+      copy(dst, src, i_blocked, i_end, j_begin, j_end, 1, dst_j, src_i, 1);
+      copy(dst, src, i_begin, i_blocked, j_blocked, j_end, 1, dst_j, src_i, 1);
+    } else {
+      copy(dst, src, i_begin, i_end, j_begin, j_end, dst_i, dst_j, src_i,
+           src_j);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void copy_block(dst_value_type* dst, const int64_t dst_j,
+                         const src_value_type* src, const int64_t src_i) {
+    for (int64_t j = 0; j < block_size; ++j) {
+      for (int64_t i = 0; i < block_size; ++i) {
+        dst[i + j * dst_j] = static_cast<dst_value_type>(src[i * src_i + j]);
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void copy(dst_value_type* dst, const src_value_type* src,
+                   const int64_t i_begin, const int64_t i_end,
+                   const int64_t j_begin, const int64_t j_end,
+                   const int64_t dst_i, const int64_t dst_j,
+                   const int64_t src_i, const int64_t src_j) {
+    for (int64_t j = j_begin; j < j_end; ++j) {
+      for (int64_t i = i_begin; i < i_end; ++i) {
+        dst[i * dst_i + j * dst_j] =
+            static_cast<dst_value_type>(src[i * src_i + j * src_j]);
+      }
+    }
+  }
+};
+
+// Copy with ViewCopyTranspose if supported, returns false otherwise
+template <class ExecutionSpace, class DstType, class SrcType>
+bool view_copy_transpose(const ExecutionSpace& space, const DstType& dst,
+                         const SrcType& src) {
+  using functor_type = ViewCopyTranspose<DstType, SrcType, ExecutionSpace>;
+  if constexpr (functor_type::is_supported_type) {
+    if (functor_type::is_applicable(dst, src)) {
+      functor_type(dst, src, space);
+      return true;
+    }
+  }
+  return false;
+}
+
+/** \brief Copy into or out of a View with LayoutTiled.
+ *
+ *  The iteration is aligned to the tiles of the destination, or of the
+ *  source if only the source is tiled, so that each tile of the iteration
+ *  accesses a single contiguous tile of that View.
+ */
+template <class DstType, class SrcType, class ExecSpace>
+struct ViewCopyTiled {
+  using value_type = typename DstType::value_type;
+
+  static constexpr bool is_supported_type =
+      is_layout_tiled_v<typename DstType::array_layout> ||
+      is_layout_tiled_v<typename SrcType::array_layout>;
+
+  DstType m_dst;
+  SrcType m_src;
+
+  ViewCopyTiled(const DstType& dst, const SrcType& src,
+                const ExecSpace& space)
+      : m_dst(dst), m_src(src) {
+    if constexpr (is_layout_tiled_v<typename DstType::array_layout>) {
+      Kokkos::parallel_for("Kokkos::ViewCopy-Tiled",
+                           Experimental::tile_aligned_policy(space, dst),
+                           *this);
+    } else {
+      Kokkos::parallel_for("Kokkos::ViewCopy-Tiled",
+                           Experimental::tile_aligned_policy(space, src),
+                           *this);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t i0, const int64_t i1) const {
+    m_dst(i0, i1) = static_cast<value_type>(m_src(i0, i1));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t i0, const int64_t i1, const int64_t i2) const {
+    m_dst(i0, i1, i2) = static_cast<value_type>(m_src(i0, i1, i2));
+  }
+};
+
+// Copy with ViewCopyTiled if supported, returns false otherwise
+template <class ExecutionSpace, class DstType, class SrcType>
+bool view_copy_tiled(const ExecutionSpace& space, const DstType& dst,
+                     const SrcType& src) {
+  using functor_type =
+      ViewCopyTiled<typename DstType::uniform_runtime_nomemspace_type,
+                    typename SrcType::uniform_runtime_const_nomemspace_type,
+                    ExecutionSpace>;
+  if constexpr (functor_type::is_supported_type) {
+    functor_type(dst, src, space);
+    return true;
+  }
+  return false;
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -556,6 +809,9 @@ void view_copy(const ExecutionSpace& space, const DstType& dst,
   if (!(ExecCanAccessSrc && ExecCanAccessDst)) {
     Kokkos::Impl::throw_runtime_exception(
         "Kokkos::Impl::view_copy called with invalid execution space");
+  } else if (view_copy_tiled(space, dst, src) ||
+             view_copy_transpose(space, dst, src)) {
+    return;
   } else {
     // Figure out iteration order in case we need it
     int64_t strides[DstType::rank + 1];
@@ -644,6 +900,18 @@ void view_copy(const DstType& dst, const SrcType& src) {
     Kokkos::Impl::throw_runtime_exception(ss.str());
   }
 
+  if constexpr (DstExecCanAccessSrc) {
+    if (view_copy_tiled(dst_execution_space(), dst, src) ||
+        view_copy_transpose(dst_execution_space(), dst, src)) {
+      return;
+    }
+  } else {
+    if (view_copy_tiled(src_execution_space(), dst, src) ||
+        view_copy_transpose(src_execution_space(), dst, src)) {
+      return;
+    }
+  }
+
   // Figure out iteration order in case we need it
   int64_t strides[DstType::rank + 1];
   dst.stride(strides);
@@ -1427,6 +1695,16 @@ contiguous_fill_or_memset(
 
   contiguous_fill(exec_space_type(), dst, value);
 }
+
+// A deep copy without an execution space instance would run right away, before
+// the operations captured so far, so it can't be issued during a capture
+inline void deep_copy_check_not_capturing() {
+  if (graph_capture_is_active()) {
+    throw_runtime_exception(
+        "Kokkos::deep_copy: a copy without an execution space instance can't "
+        "be issued during a graph capture, pass the captured instance");
+  }
+}
 }  // namespace Impl
 
 /** \brief  Deep copy a value from Host memory into a view.  */
@@ -1439,6 +1717,8 @@ inline void deep_copy(
   using ViewType        = View<DT, DP...>;
   using exec_space_type = typename ViewType::execution_space;
 
+  Impl::deep_copy_check_not_capturing();
+
   if (Kokkos::Tools::Experimental::get_callbacks().begin_deep_copy != nullptr) {
     Kokkos::Profiling::beginDeepCopy(
         Kokkos::Profiling::make_space_handle(ViewType::memory_space::name()),
@@ -1539,6 +1819,8 @@ inline void deep_copy(
   static_assert(src_traits::rank == 0,
                 "ERROR: Non-rank-zero view in deep_copy( value , View )");
 
+  Impl::deep_copy_check_not_capturing();
+
   if (Kokkos::Tools::Experimental::get_callbacks().begin_deep_copy != nullptr) {
     Kokkos::Profiling::beginDeepCopy(
         Kokkos::Profiling::make_space_handle(Kokkos::HostSpace::name()),
@@ -1583,6 +1865,8 @@ inline void deep_copy(
                                typename src_type::non_const_value_type>,
                 "deep_copy requires matching non-const destination type");
 
+  Impl::deep_copy_check_not_capturing();
+
   if (Kokkos::Tools::Experimental::get_callbacks().begin_deep_copy != nullptr) {
     Kokkos::Profiling::beginDeepCopy(
         Kokkos::Profiling::make_space_handle(dst_memory_space::name()),
@@ -1640,6 +1924,8 @@ inline void deep_copy(
   static_assert((unsigned(dst_type::rank) == unsigned(src_type::rank)),
                 "deep_copy requires Views of equal rank");
 
+  Impl::deep_copy_check_not_capturing();
+
   if (Kokkos::Tools::Experimental::get_callbacks().begin_deep_copy != nullptr) {
     Kokkos::Profiling::beginDeepCopy(
         Kokkos::Profiling::make_space_handle(dst_memory_space::name()),
@@ -2569,6 +2855,11 @@ inline void deep_copy(
                                typename dst_traits::value_type>,
                 "deep_copy requires non-const type");
   using dst_memory_space = typename dst_traits::memory_space;
+  if (Impl::graph_capture_call(
+          space, [=, value = typename dst_traits::non_const_value_type(value)] {
+            Kokkos::deep_copy(space, dst, value);
+          }))
+    return;
   if (Kokkos::Tools::Experimental::get_callbacks().begin_deep_copy != nullptr) {
     Kokkos::Profiling::beginDeepCopy(
         Kokkos::Profiling::make_space_handle(dst_memory_space::name()),
@@ -2649,6 +2940,11 @@ inline void deep_copy(
                                typename dst_traits::value_type>,
                 "deep_copy requires non-const type");
   using dst_memory_space = typename dst_traits::memory_space;
+  if (Impl::graph_capture_call(
+          space, [=, value = typename dst_traits::non_const_value_type(value)] {
+            Kokkos::deep_copy(space, dst, value);
+          }))
+    return;
   if (Kokkos::Tools::Experimental::get_callbacks().begin_deep_copy != nullptr) {
     Kokkos::Profiling::beginDeepCopy(
         Kokkos::Profiling::make_space_handle(dst_memory_space::name()),
@@ -2693,6 +2989,11 @@ inline void deep_copy(
   using src_memory_space = typename src_traits::memory_space;
   static_assert(src_traits::rank == 0,
                 "ERROR: Non-rank-zero view in deep_copy( value , View )");
+  if (Impl::graph_capture_is_capturing(exec_space)) {
+    Impl::throw_runtime_exception(
+        "Kokkos::deep_copy: a copy into a scalar can't be captured into a "
+        "graph, use a View instead");
+  }
   if (Kokkos::Tools::Experimental::get_callbacks().begin_deep_copy != nullptr) {
     Kokkos::Profiling::beginDeepCopy(
         Kokkos::Profiling::make_space_handle(Kokkos::HostSpace::name()),
@@ -2738,6 +3039,11 @@ inline void deep_copy(
                                typename src_traits::non_const_value_type>,
                 "deep_copy requires matching non-const destination type");
 
+  if (Impl::graph_capture_call(exec_space, [=] {
+        Kokkos::deep_copy(exec_space, dst, src);
+      }))
+    return;
+
   if (Kokkos::Tools::Experimental::get_callbacks().begin_deep_copy != nullptr) {
     Kokkos::Profiling::beginDeepCopy(
         Kokkos::Profiling::make_space_handle(dst_memory_space::name()),
@@ -2796,6 +3102,11 @@ inline void deep_copy(
   using dst_value_type      = typename dst_type::value_type;
   using src_value_type      = typename src_type::value_type;
 
+  if (Impl::graph_capture_call(exec_space, [=] {
+        Kokkos::deep_copy(exec_space, dst, src);
+      }))
+    return;
+
   if (Kokkos::Tools::Experimental::get_callbacks().begin_deep_copy != nullptr) {
     Kokkos::Profiling::beginDeepCopy(
         Kokkos::Profiling::make_space_handle(dst_memory_space::name()),
@@ -2980,6 +3291,160 @@ bool size_mismatch(const ViewType& view, unsigned int max_extent,
   return false;
 }
 
+// HostSpace Views of trivial values keep a capacity along their slowest
+// varying extent: Kokkos::resize and Kokkos::realloc reuse or grow the
+// allocation in place when only that extent changes.
+template <class ViewType>
+constexpr unsigned view_capacity_extent() {
+  return std::is_same_v<typename ViewType::array_layout, Kokkos::LayoutRight>
+             ? 0
+             : ViewType::rank - 1;
+}
+
+template <class ViewType>
+constexpr bool view_has_host_capacity() {
+  using traits = typename ViewType::traits;
+  if constexpr (!std::is_same_v<typename traits::memory_space,
+                                Kokkos::HostSpace> ||
+                !std::is_void_v<typename traits::specialize> ||
+                !std::is_trivial_v<typename traits::non_const_value_type> ||
+                traits::rank == 0) {
+    return false;
+  } else {
+    return view_capacity_extent<ViewType>() < traits::rank_dynamic;
+  }
+}
+
+template <class ViewType>
+bool view_only_capacity_extent_changes(const ViewType& view,
+                                       const size_t new_extents[8]) {
+  constexpr unsigned capacity_extent = view_capacity_extent<ViewType>();
+  for (unsigned int dim = 0; dim < ViewType::rank_dynamic; ++dim)
+    if (dim != capacity_extent && new_extents[dim] != view.extent(dim))
+      return false;
+  for (unsigned int dim = ViewType::rank_dynamic; dim < 8; ++dim)
+    if (new_extents[dim] != KOKKOS_IMPL_CTOR_DEFAULT_ARG) return false;
+  return true;
+}
+
+template <class ViewType>
+bool view_capacity_grows(const ViewType& view, const size_t new_extents[8]) {
+  if constexpr (view_has_host_capacity<ViewType>()) {
+    constexpr unsigned capacity_extent = view_capacity_extent<ViewType>();
+    return view.extent(capacity_extent) < new_extents[capacity_extent] &&
+           view_only_capacity_extent_changes(view, new_extents);
+  } else {
+    (void)view;
+    (void)new_extents;
+    return false;
+  }
+}
+
+template <class ViewType>
+typename ViewType::array_layout view_layout(const size_t extents[8]) {
+  return typename ViewType::array_layout(extents[0], extents[1], extents[2],
+                                         extents[3], extents[4], extents[5],
+                                         extents[6], extents[7]);
+}
+
+// View with the given layout on the memory of an existing allocation
+template <class ViewType>
+ViewType view_in_allocation(const SharedAllocationTracker& track, void* ptr,
+                            const typename ViewType::array_layout& layout) {
+  const ViewType wrapped(
+      Kokkos::view_wrap(static_cast<typename ViewType::pointer_type>(ptr)),
+      layout);
+  return ViewType(track, wrapped.impl_map());
+}
+
+/** \brief  Rebuild \c view with \c new_extents in its own allocation.
+ *
+ *  Only applies if \c view is the only View of its allocation, is not padded
+ *  and only its slowest varying extent changes.  An allocation that is too
+ *  small is grown by remapping it if HostSpace supports it for its size.  An
+ *  allocation of which less than half would remain in use is released
+ *  instead.  Returns false if \c view was left unchanged.
+ */
+template <class ViewType>
+bool view_resize_in_place(ViewType& view, const size_t new_extents[8]) {
+  if constexpr (view_has_host_capacity<ViewType>()) {
+    if (view.use_count() != 1 ||
+        !view_only_capacity_extent_changes(view, new_extents))
+      return false;
+    // the View is rebuilt with an unpadded layout, a padded View would have
+    // its entries read with the wrong strides
+    if (!view.span_is_contiguous() || view.span() != view.size()) return false;
+
+    auto* const record = view.impl_track().template get_record<HostSpace>();
+    if (!record || record->data() != view.data()) return false;
+
+    const auto layout      = view_layout<ViewType>(new_extents);
+    const size_t span_size = ViewType::required_allocation_size(layout);
+    if (span_size == 0 || 2 * span_size < record->size()) return false;
+    if (record->size() < span_size &&
+        !record->impl_try_grow(static_cast<size_t>(
+            span_size * Experimental::get_host_view_growth_factor())))
+      return false;
+
+    view = view_in_allocation<ViewType>(view.impl_track(), record->data(),
+                                        layout);
+    return true;
+  } else {
+    (void)view;
+    (void)new_extents;
+    return false;
+  }
+}
+
+/** \brief  Allocate a View with \c new_extents, with spare capacity along
+ *          its slowest varying extent if \c grows is true.
+ */
+template <class ViewType, class... ViewCtorArgs>
+ViewType view_allocate_with_capacity(
+    const Impl::ViewCtorProp<ViewCtorArgs...>& arg_prop,
+    const size_t new_extents[8], const bool grows) {
+  if constexpr (view_has_host_capacity<ViewType>()) {
+    const double factor = Experimental::get_host_view_growth_factor();
+    if (grows && 1. < factor) {
+      constexpr unsigned capacity_extent = view_capacity_extent<ViewType>();
+      size_t extents[8];
+      std::copy_n(new_extents, 8, extents);
+      extents[capacity_extent] =
+          std::ceil(new_extents[capacity_extent] * factor);
+      const ViewType allocation(arg_prop, view_layout<ViewType>(extents));
+      return view_in_allocation<ViewType>(allocation.impl_track(),
+                                          allocation.data(),
+                                          view_layout<ViewType>(new_extents));
+    }
+  }
+  (void)grows;
+  return ViewType(arg_prop, view_layout<ViewType>(new_extents));
+}
+
+// Value initialize the entries of a View past the first begin
+template <class ViewType, class... ViewCtorArgs>
+void view_initialize_tail(const Impl::ViewCtorProp<ViewCtorArgs...>& arg_prop,
+                          const ViewType& view, const size_t begin) {
+  using alloc_prop = Impl::ViewCtorProp<ViewCtorArgs...>;
+  using value_type = typename ViewType::non_const_value_type;
+  if (view.span() <= begin) return;
+
+  value_type* const ptr = const_cast<value_type*>(view.data()) + begin;
+  const size_t n        = view.span() - begin;
+  if constexpr (alloc_prop::has_execution_space) {
+    using exec_space = typename alloc_prop::execution_space;
+    ViewValueFunctor<Kokkos::Device<exec_space, HostSpace>, value_type>(
+        Impl::get_property<Impl::ExecutionSpaceTag>(arg_prop), ptr, n,
+        view.label())
+        .construct_shared_allocation();
+  } else {
+    using exec_space = typename ViewType::execution_space;
+    ViewValueFunctor<Kokkos::Device<exec_space, HostSpace>, value_type>(
+        ptr, n, view.label())
+        .construct_shared_allocation();
+  }
+}
+
 }  // namespace Impl
 
 /** \brief  Resize a view with copying old data to new data at the corresponding
@@ -3009,21 +3474,28 @@ impl_resize(const Impl::ViewCtorProp<ViewCtorArgs...>& arg_prop,
                 "The view constructor arguments passed to Kokkos::resize must "
                 "not include a memory space instance!");
 
-  // TODO (mfh 27 Jun 2017) If the old View has enough space but just
-  // different dimensions (e.g., if the product of the dimensions,
-  // including extra space for alignment, will not change), then
-  // consider just reusing storage.  For now, Kokkos always
-  // reallocates if any of the dimensions change, even if the old View
-  // has enough space.
+  // HostSpace Views are resized within their allocation when possible, see
+  // Impl::view_resize_in_place.  Otherwise Kokkos reallocates, with spare
+  // capacity if the View grows.
 
   const size_t new_extents[8] = {n0, n1, n2, n3, n4, n5, n6, n7};
   const bool sizeMismatch = Impl::size_mismatch(v, v.rank_dynamic, new_extents);
 
   if (sizeMismatch) {
+    const size_t old_span = v.span();
+    const bool grows      = Impl::view_capacity_grows(v, new_extents);
+    if (Impl::view_resize_in_place(v, new_extents)) {
+      if constexpr (alloc_prop_input::initialize)
+        Impl::view_initialize_tail(arg_prop, v, old_span);
+      return;
+    }
+
     auto prop_copy = Impl::with_properties_if_unset(
         arg_prop, typename view_type::execution_space{}, v.label());
 
-    view_type v_resized(prop_copy, n0, n1, n2, n3, n4, n5, n6, n7);
+    view_type v_resized =
+        Impl::view_allocate_with_capacity<view_type>(prop_copy, new_extents,
+                                                     grows);
 
     if constexpr (alloc_prop_input::has_execution_space)
       Kokkos::Impl::ViewRemap<view_type, view_type>(
@@ -3235,11 +3707,13 @@ impl_realloc(Kokkos::View<T, P...>& v, const size_t n0, const size_t n1,
   const size_t new_extents[8] = {n0, n1, n2, n3, n4, n5, n6, n7};
   const bool sizeMismatch = Impl::size_mismatch(v, v.rank_dynamic, new_extents);
 
-  if (sizeMismatch) {
+  if (sizeMismatch && !Impl::view_resize_in_place(v, new_extents)) {
+    const bool grows   = Impl::view_capacity_grows(v, new_extents);
     auto arg_prop_copy = Impl::with_properties_if_unset(arg_prop, v.label());
     v = view_type();  // Best effort to deallocate in case no other view refers
                       // to the shared allocation
-    v = view_type(arg_prop_copy, n0, n1, n2, n3, n4, n5, n6, n7);
+    v = Impl::view_allocate_with_capacity<view_type>(arg_prop_copy,
+                                                     new_extents, grows);
     return;
   }
 
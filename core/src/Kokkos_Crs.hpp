@@ -246,6 +246,186 @@ class FillCrsTransposeEntries {
   }
 };
 
+/* The host backends transpose without atomics: each thread counts the
+   entries of a contiguous chunk of rows into its own histogram of the
+   transposed rows, a single scan turns the histograms into the transposed
+   row map and into the offset of each chunk within each transposed row, and
+   each thread then scatters its chunk from these offsets.  The transposed
+   rows come out sorted.  The histograms take one count per thread and row,
+   so they are only used while they are not larger than the entries. */
+template <class InCrs>
+class CrsTransposeHistograms {
+ public:
+  using execution_space = typename InCrs::execution_space;
+  using memory_space    = typename InCrs::memory_space;
+  using index_type      = typename InCrs::size_type;
+  using histograms_type = View<index_type**, LayoutRight, memory_space>;
+
+  static bool is_applicable(InCrs const& in) {
+    if constexpr (std::is_same_v<typename execution_space::memory_space,
+                                 HostSpace>) {
+      const size_t num_chunks = execution_space().concurrency();
+      if (in.row_map.extent(0) == 0) return false;
+      return num_chunks == 1 ||
+             num_chunks * size_t(in.numRows()) <= size_t(in.entries.size());
+    } else {
+      return false;
+    }
+  }
+
+ private:
+  InCrs in;
+  InCrs out;
+  histograms_type histograms;
+  index_type num_chunks;
+
+  KOKKOS_INLINE_FUNCTION
+  index_type chunk_begin(index_type chunk) const {
+    return in.row_map(index_type(int64_t(in.numRows()) * chunk / num_chunks));
+  }
+
+ public:
+  struct Count {};
+  struct Fill {};
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Count, index_type chunk) const {
+    const index_type n = in.numRows();
+    for (index_type i = 0; i < n; ++i) histograms(chunk, i) = 0;
+    const index_type end = chunk_begin(chunk + 1);
+    for (index_type j = chunk_begin(chunk); j < end; ++j) {
+      ++histograms(chunk, in.entries(j));
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(Fill, index_type chunk) const {
+    const index_type n     = in.numRows();
+    const index_type begin = index_type(int64_t(n) * chunk / num_chunks);
+    const index_type end   = index_type(int64_t(n) * (chunk + 1) / num_chunks);
+    for (index_type i = begin; i < end; ++i) {
+      for (auto j = in.row_map(i); j < in.row_map(i + 1); ++j) {
+        out.entries(histograms(chunk, in.entries(j))++) = i;
+      }
+    }
+  }
+
+  histograms_type const& get_histograms() const { return histograms; }
+
+  // Counts the entries of each chunk
+  explicit CrsTransposeHistograms(InCrs const& arg_in)
+      : in(arg_in), num_chunks(execution_space().concurrency()) {
+    histograms = histograms_type(
+        view_alloc(WithoutInitializing, "Kokkos::CrsTranspose::histograms"),
+        num_chunks, in.numRows());
+    execute<Count>();
+  }
+
+  // Scatters each chunk once the histograms hold the offsets of the chunks
+  void fill(InCrs const& arg_out) {
+    out = arg_out;
+    execute<Fill>();
+    out = InCrs();
+  }
+
+ private:
+  template <class Tag>
+  void execute() const {
+    using policy_type  = RangePolicy<index_type, execution_space, Tag>;
+    using closure_type = Kokkos::Impl::ParallelFor<CrsTransposeHistograms,
+                                                   policy_type>;
+    const closure_type closure(*this, policy_type(0, num_chunks));
+    closure.execute();
+    execution_space().fence(
+        "Kokkos::Impl::CrsTransposeHistograms: fence after functor "
+        "execution");
+  }
+};
+
+template <class Histograms, class OutCounts>
+class SumCrsTransposeHistograms {
+ public:
+  using execution_space = typename OutCounts::execution_space;
+  using index_type      = typename Histograms::size_type;
+
+ private:
+  Histograms in;
+  OutCounts out;
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  void operator()(index_type i) const {
+    typename OutCounts::non_const_value_type count = 0;
+    for (index_type chunk = 0; chunk < in.extent(0); ++chunk) {
+      count += in(chunk, i);
+    }
+    out(i) = count;
+  }
+  SumCrsTransposeHistograms(Histograms const& arg_in, OutCounts const& arg_out)
+      : in(arg_in), out(arg_out) {
+    using policy_type  = RangePolicy<index_type, execution_space>;
+    using closure_type = Kokkos::Impl::ParallelFor<SumCrsTransposeHistograms,
+                                                   policy_type>;
+    const closure_type closure(*this, policy_type(0, in.extent(1)));
+    closure.execute();
+    execution_space().fence(
+        "Kokkos::Impl::SumCrsTransposeHistograms::SumCrsTransposeHistograms: "
+        "fence after functor execution");
+  }
+};
+
+// The scan producing the transposed row map also replaces each count of the
+// histograms by the offset of the chunk within the transposed row
+template <class Histograms, class OutRowMap>
+class CrsRowMapFromTransposeHistograms {
+ public:
+  using execution_space = typename OutRowMap::execution_space;
+  using value_type      = typename OutRowMap::non_const_value_type;
+  using index_type      = typename Histograms::size_type;
+
+ private:
+  Histograms m_in;
+  OutRowMap m_out;
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  void operator()(index_type i, value_type& update, bool final_pass) const {
+    if (i == m_in.extent(1)) {
+      if (final_pass) m_out(i) = update;
+    } else if (!final_pass) {
+      for (index_type chunk = 0; chunk < m_in.extent(0); ++chunk) {
+        update += m_in(chunk, i);
+      }
+    } else {
+      m_out(i) = update;
+      for (index_type chunk = 0; chunk < m_in.extent(0); ++chunk) {
+        const value_type count = m_in(chunk, i);
+        m_in(chunk, i)         = update;
+        update += count;
+      }
+    }
+  }
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& update) const { update = 0; }
+  KOKKOS_INLINE_FUNCTION
+  void join(value_type& update, const value_type& input) const {
+    update += input;
+  }
+  CrsRowMapFromTransposeHistograms(Histograms const& arg_in,
+                                   OutRowMap const& arg_out)
+      : m_in(arg_in), m_out(arg_out) {
+    using policy_type = RangePolicy<index_type, execution_space>;
+    using closure_type =
+        Kokkos::Impl::ParallelScan<CrsRowMapFromTransposeHistograms,
+                                   policy_type>;
+    closure_type closure(*this, policy_type(0, m_in.extent(1) + 1));
+    closure.execute();
+    execution_space().fence(
+        "Kokkos::Impl::CrsRowMapFromTransposeHistograms: fence after functor "
+        "execution");
+  }
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -260,8 +440,17 @@ template <class OutCounts, class DataType, class Arg1Type, class Arg2Type,
 void get_crs_transpose_counts(
     OutCounts& out, Crs<DataType, Arg1Type, Arg2Type, SizeType> const& in,
     std::string const& name) {
-  using InCrs = Crs<DataType, Arg1Type, Arg2Type, SizeType>;
-  out         = OutCounts(name, in.numRows());
+  using InCrs      = Crs<DataType, Arg1Type, Arg2Type, SizeType>;
+  using Histograms = Kokkos::Impl::CrsTransposeHistograms<InCrs>;
+  if (Histograms::is_applicable(in)) {
+    out = OutCounts(view_alloc(WithoutInitializing, name), in.numRows());
+    Histograms histograms(in);
+    Kokkos::Impl::SumCrsTransposeHistograms<
+        typename Histograms::histograms_type, OutCounts>
+        sum(histograms.get_histograms(), out);
+    return;
+  }
+  out = OutCounts(name, in.numRows());
   Kokkos::Impl::GetCrsTransposeCounts<InCrs, OutCounts> functor(in, out);
 }
 
@@ -279,6 +468,21 @@ void transpose_crs(Crs<DataType, Arg1Type, Arg2Type, SizeType>& out,
   using crs_type     = Crs<DataType, Arg1Type, Arg2Type, SizeType>;
   using memory_space = typename crs_type::memory_space;
   using counts_type  = View<SizeType*, memory_space>;
+  using Histograms   = Kokkos::Impl::CrsTransposeHistograms<crs_type>;
+  if (Histograms::is_applicable(in)) {
+    Histograms histograms(in);
+    out.row_map = decltype(out.row_map)(
+        view_alloc(WithoutInitializing, "tranpose_row_map"),
+        in.numRows() + 1);
+    Kokkos::Impl::CrsRowMapFromTransposeHistograms<
+        typename Histograms::histograms_type, decltype(out.row_map)>
+        scan(histograms.get_histograms(), out.row_map);
+    out.entries = decltype(out.entries)(
+        view_alloc(WithoutInitializing, "transpose_entries"),
+        in.entries.size());
+    histograms.fill(out);
+    return;
+  }
   {
     counts_type counts;
     Kokkos::get_crs_transpose_counts(counts, in);
@@ -336,7 +540,11 @@ struct CountAndFill : public CountAndFillBase<CrsType, Functor> {
   CountAndFill(CrsType& crs, size_type nrows, Functor const& f)
       : base_type(crs, f) {
     using execution_space = typename CrsType::execution_space;
-    this->m_counts        = counts_type("counts", nrows);
+    // The rows are counted into the row map, which is then scanned in place
+    this->m_crs.row_map = typename CrsType::row_map_type(
+        view_alloc(WithoutInitializing, "row_map"), nrows + 1);
+    this->m_counts =
+        Kokkos::subview(this->m_crs.row_map, Kokkos::make_pair(1, nrows + 1));
     {
       using count_policy_type = RangePolicy<size_type, execution_space, Count>;
       using count_closure_type =
@@ -344,8 +552,10 @@ struct CountAndFill : public CountAndFillBase<CrsType, Functor> {
       const count_closure_type closure(*this, count_policy_type(0, nrows));
       closure.execute();
     }
-    auto nentries  = Kokkos::get_crs_row_map_from_counts(this->m_crs.row_map,
-                                                         this->m_counts);
+    auto nentries =
+        Kokkos::Impl::CrsRowMapFromCounts<counts_type, counts_type>(
+            this->m_counts, this->m_crs.row_map)
+            .execute();
     this->m_counts = counts_type();
     this->m_crs.entries = entries_type("entries", nentries);
     {
@@ -37,6 +37,10 @@ static_assert(false,
 
 namespace Kokkos {
 
+namespace Impl {
+class HostSerialThreshold;
+}
+
 struct ParallelForTag {};
 struct ParallelScanTag {};
 struct ParallelReduceTag {};
@@ -83,6 +87,9 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
   typename traits::index_type m_end;
   typename traits::index_type m_granularity;
   typename traits::index_type m_granularity_mask;
+  bool m_auto_chunk_size;
+  int64_t m_serial_threshold;
+  Impl::HostSerialThreshold* m_serial_threshold_state;
 
   template <class... OtherProperties>
   friend class RangePolicy;
@@ -113,14 +120,20 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
         m_begin(p.m_begin),
         m_end(p.m_end),
         m_granularity(p.m_granularity),
-        m_granularity_mask(p.m_granularity_mask) {}
+        m_granularity_mask(p.m_granularity_mask),
+        m_auto_chunk_size(p.m_auto_chunk_size),
+        m_serial_threshold(p.m_serial_threshold),
+        m_serial_threshold_state(p.m_serial_threshold_state) {}
 
   inline RangePolicy()
       : m_space(),
         m_begin(0),
         m_end(0),
         m_granularity(0),
-        m_granularity_mask(0) {}
+        m_granularity_mask(0),
+        m_auto_chunk_size(false),
+        m_serial_threshold(-1),
+        m_serial_threshold_state(nullptr) {}
 
   /** \brief  Total range */
   template <typename IndexType1, typename IndexType2,
@@ -141,7 +154,10 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
         m_begin(work_begin),
         m_end(work_end),
         m_granularity(0),
-        m_granularity_mask(0) {
+        m_granularity_mask(0),
+        m_auto_chunk_size(false),
+        m_serial_threshold(-1),
+        m_serial_threshold_state(nullptr) {
     check_conversion_safety(work_begin);
     check_conversion_safety(work_end);
     check_bounds_validity();
@@ -159,7 +175,10 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
         m_begin(work_begin),
         m_end(work_end),
         m_granularity(0),
-        m_granularity_mask(0) {
+        m_granularity_mask(0),
+        m_auto_chunk_size(false),
+        m_serial_threshold(-1),
+        m_serial_threshold_state(nullptr) {
     check_conversion_safety(work_begin);
     check_conversion_safety(work_end);
     check_bounds_validity();
@@ -182,6 +201,7 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
   inline void set(ChunkSize chunksize) {
     m_granularity      = chunksize.value;
     m_granularity_mask = m_granularity - 1;
+    m_auto_chunk_size  = false;
   }
 #endif
 
@@ -193,12 +213,52 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
   inline RangePolicy& set_chunk_size(int chunk_size) {
     m_granularity      = chunk_size;
     m_granularity_mask = m_granularity - 1;
+    m_auto_chunk_size  = false;
     return *this;
   }
 
+  /** \brief whether the chunk_size was chosen by the heuristic rather than
+   *         requested by the user (in which case it may be tuned) */
+  inline bool impl_auto_chunk_size() const { return m_auto_chunk_size; }
+
+  inline void impl_set_tuned_chunk_size(int chunk_size) {
+    m_granularity      = chunk_size;
+    m_granularity_mask = m_granularity - 1;
+  }
+
+  /** \brief launches of fewer than \c n iterations run serially on the
+   *         calling thread instead of using the thread pool, on the host
+   *         backends supporting it (OpenMP). 0 always uses the pool.
+   *
+   *  By default the threshold is learned per kernel label when tuning
+   *  internals, see Impl::HostSerialThreshold, or chosen by a tuning tool
+   *  through the kokkos.host_serial_threshold output variable.
+   */
+  inline RangePolicy& set_serial_threshold(int64_t n) {
+    if (n < 0) {
+      Kokkos::abort("Kokkos::RangePolicy: the serial threshold must be >= 0");
+    }
+    m_serial_threshold       = n;
+    m_serial_threshold_state = nullptr;
+    return *this;
+  }
+
+  /** \brief return the serial threshold, -1 if it was not set */
+  inline int64_t serial_threshold() const { return m_serial_threshold; }
+
+  inline Impl::HostSerialThreshold* impl_serial_threshold_state() const {
+    return m_serial_threshold_state;
+  }
+
+  inline void impl_set_serial_threshold_state(
+      Impl::HostSerialThreshold* state) {
+    m_serial_threshold_state = state;
+  }
+
  private:
   /** \brief finalize chunk_size if it was set to AUTO*/
   inline void set_auto_chunk_size() {
+    m_auto_chunk_size = true;
 #ifdef KOKKOS_ENABLE_SYCL
     if (std::is_same_v<typename traits::execution_space, Kokkos::SYCL>) {
       // chunk_size <=1 lets the compiler choose the workgroup size when
@@ -256,12 +316,6 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
 #if !defined(KOKKOS_ENABLE_DEPRECATED_CODE_4) || \
     defined(KOKKOS_ENABLE_DEPRECATION_WARNINGS)
 
-      std::string msg =
-          "Kokkos::RangePolicy bound type error: an unsafe implicit conversion "
-          "is performed on a bound (" +
-          std::to_string(bound) +
-          "), which may "
-          "not preserve its original value.\n";
       bool warn = false;
 
       if constexpr (std::is_arithmetic_v<member_type> &&
@@ -282,7 +336,15 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
       warn |=
           (static_cast<IndexType>(static_cast<member_type>(bound)) != bound);
 
+      // the message is only built when the check fails, constructing a policy
+      // does not allocate
       if (warn) {
+        std::string msg =
+            "Kokkos::RangePolicy bound type error: an unsafe implicit "
+            "conversion is performed on a bound (" +
+            std::to_string(bound) +
+            "), which may "
+            "not preserve its original value.\n";
 #ifndef KOKKOS_ENABLE_DEPRECATED_CODE_4
         Kokkos::abort(msg.c_str());
 #endif
@@ -1224,43 +1286,44 @@ template <typename FunctorType, typename TagType,
           bool HasTag = !std::is_void_v<TagType>>
 struct ParallelConstructName;
 
+// The name of an unlabeled kernel is built once per functor and tag types, so
+// that launching it does not allocate a new string every time
 template <typename FunctorType, typename TagType>
 struct ParallelConstructName<FunctorType, TagType, true> {
-  ParallelConstructName(std::string const& label) : label_ref(label) {
-    if (label.empty()) {
+  ParallelConstructName(std::string const& label) : label_ref(label) {}
+  std::string const& get() {
+    return (label_ref.empty()) ? default_name() : label_ref;
+  }
+  static std::string const& default_name() {
 #ifdef KOKKOS_ENABLE_IMPL_TYPEINFO
-      default_name =
-          std::string(TypeInfo<std::remove_const_t<FunctorType>>::name()) +
-          "/" + std::string(TypeInfo<TagType>::name());
+    static const std::string name =
+        std::string(TypeInfo<std::remove_const_t<FunctorType>>::name()) + "/" +
+        std::string(TypeInfo<TagType>::name());
 #else
-      default_name = std::string(typeid(FunctorType).name()) + "/" +
-                     typeid(TagType).name();
+    static const std::string name =
+        std::string(typeid(FunctorType).name()) + "/" + typeid(TagType).name();
 #endif
-    }
-  }
-  std::string const& get() {
-    return (label_ref.empty()) ? default_name : label_ref;
+    return name;
   }
   std::string const& label_ref;
-  std::string default_name;
 };
 
 template <typename FunctorType, typename TagType>
 struct ParallelConstructName<FunctorType, TagType, false> {
-  ParallelConstructName(std::string const& label) : label_ref(label) {
-    if (label.empty()) {
+  ParallelConstructName(std::string const& label) : label_ref(label) {}
+  std::string const& get() {
+    return (label_ref.empty()) ? default_name() : label_ref;
+  }
+  static std::string const& default_name() {
 #ifdef KOKKOS_ENABLE_IMPL_TYPEINFO
-      default_name = TypeInfo<std::remove_const_t<FunctorType>>::name();
+    static const std::string name(
+        TypeInfo<std::remove_const_t<FunctorType>>::name());
 #else
-      default_name = typeid(FunctorType).name();
+    static const std::string name(typeid(FunctorType).name());
 #endif
-    }
-  }
-  std::string const& get() {
-    return (label_ref.empty()) ? default_name : label_ref;
+    return name;
   }
   std::string const& label_ref;
-  std::string default_name;
 };
 
 }  // namespace Impl
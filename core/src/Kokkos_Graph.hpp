@@ -29,6 +29,7 @@
 
 // GraphAccess needs to be defined, not just declared
 #include <impl/Kokkos_GraphImpl.hpp>
+#include <impl/Kokkos_GraphCapture.hpp>
 
 #include <functional>
 #include <memory>
@@ -168,6 +169,72 @@ create_graph(Closure&& arg_closure) {
 // </editor-fold> end create_graph }}}1
 //==============================================================================
 
+//==============================================================================
+// <editor-fold desc="capture"> {{{1
+
+// Until end_capture(exec), the kernels and deep copies issued on exec are
+// recorded into a graph instead of being executed.  Each of them comes after
+// the previous one issued on exec, and a fence of a captured instance puts the
+// later operations of all the instances of the capture after the ones issued
+// so far on the fenced instance (after all of them for a global fence).
+// Replaying the graph fuses and overlaps the kernels like for a graph built
+// with create_graph.  Reductions, scans and deep copies into a scalar can't be
+// captured, since their result would only be available once the graph is
+// submitted.  Deep copies without an execution space instance can't be issued
+// while a capture is active, they would run before the captured operations.
+template <class ExecutionSpace>
+void begin_capture(ExecutionSpace const& exec) {
+  static_assert(Kokkos::Impl::is_graph_capturable_v<ExecutionSpace>,
+                "Only host execution spaces can be captured into a graph");
+  if (Kokkos::Impl::graph_capture_is_capturing(exec)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::begin_capture: the execution space instance is "
+        "already being captured");
+  }
+  Kokkos::Impl::graph_capture_begin(
+      Kokkos::Impl::graph_capture_key(exec),
+      std::make_shared<Kokkos::Impl::GraphCapture>(
+          std::make_shared<ExecutionSpace>(exec)),
+      0);
+}
+
+// Captures exec into the same graph as capturing_exec, its operations come
+// after the ones issued so far on capturing_exec
+template <class ExecutionSpace>
+void begin_capture(ExecutionSpace const& exec,
+                   ExecutionSpace const& capturing_exec) {
+  static_assert(Kokkos::Impl::is_graph_capturable_v<ExecutionSpace>,
+                "Only host execution spaces can be captured into a graph");
+  int forked_from = 0;
+  auto capture    = Kokkos::Impl::graph_capture_find(
+      Kokkos::Impl::graph_capture_key(capturing_exec), forked_from);
+  if (!capture || Kokkos::Impl::graph_capture_is_capturing(exec)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::begin_capture: the execution space instance "
+        "must not be captured yet and the other one must be");
+  }
+  const int instance = capture->add_instance(
+      std::make_shared<ExecutionSpace>(exec), forked_from);
+  Kokkos::Impl::graph_capture_begin(Kokkos::Impl::graph_capture_key(exec),
+                                    std::move(capture), instance);
+}
+
+// Ends the capture begun on exec, on exec and on the instances captured into
+// the same graph
+template <class ExecutionSpace>
+Graph<ExecutionSpace> end_capture(ExecutionSpace const& exec) {
+  static_assert(Kokkos::Impl::is_graph_capturable_v<ExecutionSpace>,
+                "Only host execution spaces can be captured into a graph");
+  auto capture =
+      Kokkos::Impl::graph_capture_end(Kokkos::Impl::graph_capture_key(exec));
+  auto rv = Kokkos::Impl::GraphAccess::construct_graph(exec);
+  Kokkos::Impl::GraphAccess::add_captured_operations(rv, *capture);
+  return rv;
+}
+
+// </editor-fold> end capture }}}1
+//==============================================================================
+
 }  // end namespace Experimental
 }  // namespace Kokkos
 
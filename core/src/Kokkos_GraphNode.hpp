@@ -333,6 +333,9 @@ class GraphNodeRef {
         // TODO @graph make defaulted execution space work
         // || policy_t::execution_space_is_defaulted,
         "Execution Space mismatch between execution policy and graph");
+    static_assert(Kokkos::Impl::reproducible_reduce_is_supported_v<policy_t>,
+                  "Kokkos::Graph: Experimental::Reproducible is only honored "
+                  "by RangePolicy on the Serial, OpenMP and Threads backends");
 
     // This is also just an expectation, but it's one that we expect the user
     // to interact with (even in release mode), so we should throw an exception
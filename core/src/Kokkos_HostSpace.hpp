@@ -130,6 +130,19 @@ class HostSpace {
   static constexpr const char* m_name = "Host";
 };
 
+namespace Experimental {
+
+/** \brief  Factor by which Kokkos::resize and Kokkos::realloc over-allocate
+ *          HostSpace Views that outgrow their allocation.
+ *
+ *  Later resizes within the capacity reuse the allocation in place.  A
+ *  factor of 1 allocates exactly the requested size.  Defaults to 1.5.
+ */
+void set_host_view_growth_factor(double factor);
+double get_host_view_growth_factor() noexcept;
+
+}  // namespace Experimental
+
 }  // namespace Kokkos
 
 //----------------------------------------------------------------------------
@@ -141,6 +154,11 @@ namespace Impl {
 static_assert(Kokkos::Impl::MemorySpaceAccess<Kokkos::HostSpace,
                                               Kokkos::HostSpace>::assignable);
 
+/// Allocations of at least this many bytes are mapped directly from the
+/// operating system where it supports remapping them, so that capacity
+/// aware resizes can grow them without a copy.
+inline constexpr size_t host_space_remap_threshold = size_t(1) << 25;
+
 template <typename S>
 struct HostMirror {
  private:
@@ -175,7 +193,22 @@ struct HostMirror {
 
 //----------------------------------------------------------------------------
 
-KOKKOS_IMPL_SHARED_ALLOCATION_SPECIALIZATION(Kokkos::HostSpace);
+template <>
+class Kokkos::Impl::SharedAllocationRecord<Kokkos::HostSpace, void>
+    : public Kokkos::Impl::SharedAllocationRecordCommon<Kokkos::HostSpace> {
+  using SharedAllocationRecordCommon<
+      Kokkos::HostSpace>::SharedAllocationRecordCommon;
+
+ public:
+  /**\brief  Grow the user memory to at least arg_alloc_size bytes without
+   *         copying it, keeping its contents.
+   *
+   *  Only allocations that HostSpace mapped directly from the operating
+   *  system can be grown, by remapping their pages.  The data pointer may
+   *  change.  Returns false if the allocation was left untouched.
+   */
+  bool impl_try_grow(size_t arg_alloc_size);
+};
 
 //----------------------------------------------------------------------------
 
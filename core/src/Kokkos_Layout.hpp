@@ -232,6 +232,103 @@ template <typename Layout, class Enable = void>
 struct KOKKOS_DEPRECATED is_layouttiled : std::false_type {};
 #endif
 
+namespace Experimental {
+
+/// \brief Order in which the tiles of a LayoutTiled are stored.
+///
+/// Morton stores the tiles along a Z-order curve, so that tiles which are
+/// close to each other in any direction are also close in memory. The curve
+/// runs through square blocks of tiles which are stored in row-major order,
+/// the blocks are small enough to waste little memory at the edges of the
+/// tile grid.
+enum class TileOrder { Left, Right, Morton };
+
+//----------------------------------------------------------------------------
+/// \struct LayoutTiled
+/// \brief Memory layout tag for Views of rank 2 or 3 stored as a grid of
+///   tiles of compile-time extents.
+///
+/// Every tile of N0 x N1 (x N2) entries is contiguous in memory with the
+/// entries ordered according to InnerP, and the tiles are ordered according
+/// to OuterP. Tile extents must be powers of two, ArgN2 == 0 gives tiles of
+/// rank 2. Sweeping over such a View tile by tile only touches a few pages
+/// and cache lines at a time, whatever the extents of the View are, see
+/// Kokkos::Experimental::tile_aligned_policy.
+template <TileOrder OuterP, Kokkos::Iterate InnerP, unsigned ArgN0,
+          unsigned ArgN1, unsigned ArgN2 = 0>
+struct LayoutTiled {
+  static_assert(InnerP == Kokkos::Iterate::Left ||
+                    InnerP == Kokkos::Iterate::Right,
+                "LayoutTiled requires Iterate::Left or Iterate::Right as "
+                "order of the entries in a tile");
+  static_assert(Impl::is_integral_power_of_two(ArgN0) &&
+                    Impl::is_integral_power_of_two(ArgN1) &&
+                    (ArgN2 == 0 || Impl::is_integral_power_of_two(ArgN2)),
+                "LayoutTiled requires power-of-two tile extents");
+
+  //! Tag this class as a kokkos array layout
+  using array_layout = LayoutTiled;
+
+  static constexpr TileOrder outer_pattern       = OuterP;
+  static constexpr Kokkos::Iterate inner_pattern = InnerP;
+
+  static constexpr unsigned rank = ArgN2 == 0 ? 2 : 3;
+  static constexpr unsigned N0   = ArgN0;
+  static constexpr unsigned N1   = ArgN1;
+  static constexpr unsigned N2   = ArgN2 == 0 ? 1 : ArgN2;
+
+  KOKKOS_INLINE_FUNCTION
+  static constexpr unsigned tile_extent(const unsigned r) {
+    return r == 0 ? N0 : r == 1 ? N1 : r == 2 ? N2 : 1;
+  }
+
+  size_t dimension[ARRAY_LAYOUT_MAX_RANK];
+
+  enum : bool { is_extent_constructible = true };
+
+  LayoutTiled(LayoutTiled const&)            = default;
+  LayoutTiled(LayoutTiled&&)                 = default;
+  LayoutTiled& operator=(LayoutTiled const&) = default;
+  LayoutTiled& operator=(LayoutTiled&&)      = default;
+
+  KOKKOS_INLINE_FUNCTION
+  explicit constexpr LayoutTiled(size_t argN0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t argN1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t argN2 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t argN3 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t argN4 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t argN5 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t argN6 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                                 size_t argN7 = KOKKOS_IMPL_CTOR_DEFAULT_ARG)
+      : dimension{argN0, argN1, argN2, argN3, argN4, argN5, argN6, argN7} {}
+
+  friend bool operator==(const LayoutTiled& left, const LayoutTiled& right) {
+    for (unsigned int r = 0; r < ARRAY_LAYOUT_MAX_RANK; ++r)
+      if (left.dimension[r] != right.dimension[r]) return false;
+    return true;
+  }
+
+  friend bool operator!=(const LayoutTiled& left, const LayoutTiled& right) {
+    return !(left == right);
+  }
+};
+
+}  // namespace Experimental
+
+namespace Impl {
+template <typename Layout>
+struct is_layout_tiled : std::false_type {};
+
+template <Experimental::TileOrder OuterP, Kokkos::Iterate InnerP,
+          unsigned ArgN0, unsigned ArgN1, unsigned ArgN2>
+struct is_layout_tiled<
+    Experimental::LayoutTiled<OuterP, InnerP, ArgN0, ArgN1, ArgN2>>
+    : std::true_type {};
+
+template <typename Layout>
+inline constexpr bool is_layout_tiled_v = is_layout_tiled<Layout>::value;
+}  // namespace Impl
+
 namespace Impl {
 // For use with view_copy
 template <typename... Layout>
@@ -261,6 +358,17 @@ struct layout_iterate_type_selector<Kokkos::LayoutStride> {
   static const Kokkos::Iterate inner_iteration_pattern =
       Kokkos::Iterate::Default;
 };
+
+template <Experimental::TileOrder OuterP, Kokkos::Iterate InnerP,
+          unsigned ArgN0, unsigned ArgN1, unsigned ArgN2>
+struct layout_iterate_type_selector<
+    Experimental::LayoutTiled<OuterP, InnerP, ArgN0, ArgN1, ArgN2>> {
+  // Morton blocks are stored in row-major order
+  static const Kokkos::Iterate outer_iteration_pattern =
+      OuterP == Experimental::TileOrder::Left ? Kokkos::Iterate::Left
+                                              : Kokkos::Iterate::Right;
+  static const Kokkos::Iterate inner_iteration_pattern = InnerP;
+};
 }  // namespace Impl
 
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_4
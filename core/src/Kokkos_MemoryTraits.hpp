@@ -41,7 +41,8 @@ enum MemoryTraitsFlags {
   RandomAccess = 0x02,
   Atomic       = 0x04,
   Restrict     = 0x08,
-  Aligned      = 0x10
+  Aligned      = 0x10,
+  Streaming    = 0x20
 };
 
 template <unsigned T>
@@ -61,6 +62,8 @@ struct MemoryTraits {
       (unsigned(0) != (T & unsigned(Kokkos::Restrict)));
   static constexpr bool is_aligned =
       (unsigned(0) != (T & unsigned(Kokkos::Aligned)));
+  static constexpr bool is_streaming =
+      (unsigned(0) != (T & unsigned(Kokkos::Streaming)));
 };
 
 }  // namespace Kokkos
@@ -32,6 +32,7 @@ static_assert(false,
 
 #include <impl/Kokkos_Tools.hpp>
 #include <impl/Kokkos_Tools_Generic.hpp>
+#include <impl/Kokkos_GraphCapture.hpp>
 
 #include <impl/Kokkos_Traits.hpp>
 #include <impl/Kokkos_FunctorAnalysis.hpp>
@@ -132,6 +133,11 @@ template <
     class Enable = std::enable_if_t<is_execution_policy<ExecPolicy>::value>>
 inline void parallel_for(const std::string& str, const ExecPolicy& policy,
                          const FunctorType& functor) {
+  if (Kokkos::Impl::graph_capture_record<
+          Kokkos::Impl::GraphCapturedParallelFor<FunctorType, ExecPolicy>>(
+          policy.space(), functor, policy))
+    return;
+
   uint64_t kpID = 0;
 
   /** Request a tuned policy from the tools subsystem */
@@ -350,6 +356,15 @@ template <class ExecutionPolicy, class FunctorType,
               std::enable_if_t<is_execution_policy<ExecutionPolicy>::value>>
 inline void parallel_scan(const std::string& str, const ExecutionPolicy& policy,
                           const FunctorType& functor) {
+  static_assert(!ExecutionPolicy::is_reproducible::value,
+                "Kokkos::parallel_scan: Experimental::Reproducible is only "
+                "honored by parallel_reduce");
+
+  if (Kokkos::Impl::graph_capture_record<Kokkos::Impl::GraphCapturedKernel<
+          Impl::ParallelScan<FunctorType, ExecutionPolicy>>>(
+          policy.space(), functor, policy))
+    return;
+
   uint64_t kpID = 0;
   /** Request a tuned policy from the tools subsystem */
   const auto& response =
@@ -397,6 +412,22 @@ template <class ExecutionPolicy, class FunctorType, class ReturnType,
 inline void parallel_scan(const std::string& str, const ExecutionPolicy& policy,
                           const FunctorType& functor,
                           ReturnType& return_value) {
+  static_assert(!ExecutionPolicy::is_reproducible::value,
+                "Kokkos::parallel_scan: Experimental::Reproducible is only "
+                "honored by parallel_reduce");
+
+  if constexpr (Kokkos::is_view<ReturnType>::value) {
+    if (Kokkos::Impl::graph_capture_record<Kokkos::Impl::GraphCapturedKernel<
+            Impl::ParallelScanWithTotal<FunctorType, ExecutionPolicy,
+                                        typename ReturnType::value_type>>>(
+            policy.space(), functor, policy, return_value))
+      return;
+  } else if (Kokkos::Impl::graph_capture_is_capturing(policy.space())) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::parallel_scan: a scan into a scalar can't be captured into a "
+        "graph, use a View instead");
+  }
+
   uint64_t kpID                = 0;
   ExecutionPolicy inner_policy = policy;
   Kokkos::Tools::Impl::begin_parallel_scan(inner_policy, functor, str, kpID);
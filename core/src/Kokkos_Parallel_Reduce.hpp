@@ -1501,6 +1501,52 @@ struct ParallelReduceFunctorType {
   }
 };
 
+template <typename T>
+struct ReducerHasTestReferenceFunction {
+  template <typename E>
+  static std::true_type test_func(decltype(&E::references_scalar));
+  template <typename E>
+  static std::false_type test_func(...);
+
+  enum {
+    value = std::is_same_v<std::true_type, decltype(test_func<T>(nullptr))>
+  };
+};
+
+template <class ExecutionSpace, class Arg>
+constexpr std::enable_if_t<
+    // constraints only necessary because SFINAE lacks subsumption
+    !ReducerHasTestReferenceFunction<Arg>::value &&
+        !Kokkos::is_view<Arg>::value,
+    // return type:
+    bool>
+parallel_reduce_needs_fence(ExecutionSpace const&, Arg const&) {
+  return true;
+}
+
+template <class ExecutionSpace, class Reducer>
+constexpr std::enable_if_t<
+    // equivalent to:
+    // (requires (Reducer const& r) {
+    //   { reducer.references_scalar() } -> std::convertible_to<bool>;
+    // })
+    ReducerHasTestReferenceFunction<Reducer>::value,
+    // return type:
+    bool>
+parallel_reduce_needs_fence(ExecutionSpace const&, Reducer const& reducer) {
+  return reducer.references_scalar();
+}
+
+template <class ExecutionSpace, class ViewLike>
+constexpr std::enable_if_t<
+    // requires Kokkos::ViewLike<ViewLike>
+    Kokkos::is_view<ViewLike>::value,
+    // return type:
+    bool>
+parallel_reduce_needs_fence(ExecutionSpace const&, ViewLike const&) {
+  return false;
+}
+
 template <class PolicyType, class FunctorType, class ReturnType>
 struct ParallelReduceAdaptor {
   using return_value_adapter =
@@ -1510,6 +1556,10 @@ struct ParallelReduceAdaptor {
                                   const PolicyType& policy,
                                   const FunctorType& functor,
                                   ReturnType& return_value) {
+    static_assert(Impl::reproducible_reduce_is_supported_v<PolicyType>,
+                  "Kokkos::parallel_reduce: Experimental::Reproducible is "
+                  "only honored by RangePolicy on the Serial, OpenMP and "
+                  "Threads backends");
     using PassedReducerType = typename return_value_adapter::reducer_type;
     uint64_t kpID           = 0;
 
@@ -1525,17 +1575,30 @@ struct ParallelReduceAdaptor {
     CombinedFunctorReducerType functor_reducer(
         functor, typename Analysis::Reducer(
                      ReducerSelector::select(functor, return_value)));
+
+    using ClosureType =
+        Impl::ParallelReduce<CombinedFunctorReducerType, PolicyType,
+                             typename Impl::FunctorPolicyExecutionSpace<
+                                 FunctorType, PolicyType>::execution_space>;
+    if (Impl::graph_capture_is_capturing(policy.space()) &&
+        Impl::parallel_reduce_needs_fence(policy.space(), return_value)) {
+      Impl::throw_runtime_exception(
+          "Kokkos::parallel_reduce: a reduction into a scalar can't be "
+          "captured into a graph, use a View instead");
+    }
+    if (Impl::graph_capture_record<GraphCapturedKernel<ClosureType>>(
+            policy.space(), functor_reducer, policy,
+            return_value_adapter::return_value(return_value, functor)))
+      return;
+
     const auto& response = Kokkos::Tools::Impl::begin_parallel_reduce<
         typename return_value_adapter::reducer_type>(policy, functor_reducer,
                                                      label, kpID);
     const auto& inner_policy = response.policy;
 
     auto closure = construct_with_shared_allocation_tracking_disabled<
-        Impl::ParallelReduce<CombinedFunctorReducerType, PolicyType,
-                             typename Impl::FunctorPolicyExecutionSpace<
-                                 FunctorType, PolicyType>::execution_space>>(
-        functor_reducer, inner_policy,
-        return_value_adapter::return_value(return_value, functor));
+        ClosureType>(functor_reducer, inner_policy,
+                     return_value_adapter::return_value(return_value, functor));
     closure.execute();
 
     Kokkos::Tools::Impl::end_parallel_reduce<PassedReducerType>(
@@ -1573,56 +1636,12 @@ struct ParallelReduceAdaptor {
 // Parallel Reduce Blocking behavior
 
 namespace Impl {
-template <typename T>
-struct ReducerHasTestReferenceFunction {
-  template <typename E>
-  static std::true_type test_func(decltype(&E::references_scalar));
-  template <typename E>
-  static std::false_type test_func(...);
-
-  enum {
-    value = std::is_same_v<std::true_type, decltype(test_func<T>(nullptr))>
-  };
-};
-
-template <class ExecutionSpace, class Arg>
-constexpr std::enable_if_t<
-    // constraints only necessary because SFINAE lacks subsumption
-    !ReducerHasTestReferenceFunction<Arg>::value &&
-        !Kokkos::is_view<Arg>::value,
-    // return type:
-    bool>
-parallel_reduce_needs_fence(ExecutionSpace const&, Arg const&) {
-  return true;
-}
-
-template <class ExecutionSpace, class Reducer>
-constexpr std::enable_if_t<
-    // equivalent to:
-    // (requires (Reducer const& r) {
-    //   { reducer.references_scalar() } -> std::convertible_to<bool>;
-    // })
-    ReducerHasTestReferenceFunction<Reducer>::value,
-    // return type:
-    bool>
-parallel_reduce_needs_fence(ExecutionSpace const&, Reducer const& reducer) {
-  return reducer.references_scalar();
-}
-
-template <class ExecutionSpace, class ViewLike>
-constexpr std::enable_if_t<
-    // requires Kokkos::ViewLike<ViewLike>
-    Kokkos::is_view<ViewLike>::value,
-    // return type:
-    bool>
-parallel_reduce_needs_fence(ExecutionSpace const&, ViewLike const&) {
-  return false;
-}
-
 template <class ExecutionSpace, class... Args>
 struct ParallelReduceFence {
+  // the name is only made a string when fencing, a reduction into a View
+  // does not allocate it at every launch
   template <class... ArgsDeduced>
-  static void fence(const ExecutionSpace& ex, const std::string& name,
+  static void fence(const ExecutionSpace& ex, const char* name,
                     ArgsDeduced&&... args) {
     if (Impl::parallel_reduce_needs_fence(ex, (ArgsDeduced&&)args...)) {
       ex.fence(name);
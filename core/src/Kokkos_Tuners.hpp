@@ -28,7 +28,9 @@ static_assert(false,
 #include <KokkosExp_MDRangePolicy.hpp>
 #include <impl/Kokkos_Profiling_Interface.hpp>
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <utility>
 #include <tuple>
 #include <string>
@@ -57,8 +59,96 @@ SetOrRange make_candidate_range(int64_t lower, int64_t upper, int64_t step,
 size_t get_new_context_id();
 void begin_context(size_t context_id);
 void end_context(size_t context_id);
+
+// The default tuner is the in-library tuner used when internal tuning is
+// requested but no tool implementing the tuning callbacks is loaded
+bool have_default_tuner();
+
 namespace Impl {
 
+inline constexpr size_t invalid_default_tuning_problem = ~size_t(0);
+
+/// One launch of a tuning problem: the candidate it runs and when it started
+struct DefaultTuningToken {
+  size_t problem   = invalid_default_tuning_problem;
+  size_t candidate = 0;
+  bool measuring   = false;
+  std::chrono::steady_clock::time_point start;
+};
+
+/// The launch begun by a tuner on the calling thread, with its configuration
+struct DefaultTuningLaunch {
+  DefaultTuningToken token;
+  std::vector<int64_t> configuration;
+};
+
+size_t get_default_tuning_problem(const std::string& key);
+size_t declare_default_tuning_problem(
+    const std::string& key, std::vector<std::vector<int64_t>> candidates);
+DefaultTuningToken begin_default_tuning(size_t problem,
+                                        std::vector<int64_t>& configuration);
+bool default_tuning_is_measuring(size_t problem);
+void end_default_tuning(const DefaultTuningToken& token);
+DefaultTuningLaunch& default_tuning_launch(const void* tuner);
+void initialize_default_tuner(const std::string& cache_file);
+void finalize_default_tuner();
+
+/** A tuner sees one default tuning problem per policy shape. The shape is
+ * bucketed into powers of two so that a configuration found for a kernel is
+ * reused for kernels of similar size.
+ */
+inline int64_t default_tuning_shape_bucket(int64_t extent) {
+  int64_t bucket = 0;
+  while ((int64_t(1) << bucket) < extent) ++bucket;
+  return bucket;
+}
+
+template <class Extents>
+std::string default_tuning_key(const std::string& name, const char* kind,
+                               int concurrency, const Extents& extents) {
+  std::string key = name;
+  key += '|';
+  key += kind;
+  key += "|c";
+  key += std::to_string(concurrency);
+  for (size_t i = 0; i < extents.size(); ++i) {
+    key += '|';
+    key += std::to_string(default_tuning_shape_bucket(extents[i]));
+  }
+  return key;
+}
+
+/** State of one policy tuner for the default tuner. The launch measured
+ * between begin() and end() and the configuration chosen for it are kept per
+ * thread, since the same kernel can be launched from several threads at once.
+ */
+class DefaultTunerState {
+ public:
+  // Returns the configuration to use, empty if there is nothing to tune.
+  // generate_candidates is only called the first time a key is seen.
+  template <class CandidateGenerator>
+  const std::vector<int64_t>& begin(
+      const std::string& key, const CandidateGenerator& generate_candidates) {
+    auto& launch = default_tuning_launch(this);
+    auto problem = get_default_tuning_problem(key);
+    if (problem == invalid_default_tuning_problem) {
+      problem = declare_default_tuning_problem(key, generate_candidates());
+    }
+    launch.token = begin_default_tuning(problem, launch.configuration);
+    return launch.configuration;
+  }
+
+  bool measuring() const {
+    return default_tuning_launch(this).token.measuring;
+  }
+
+  void end() {
+    auto& launch = default_tuning_launch(this);
+    end_default_tuning(launch.token);
+    launch.token.measuring = false;
+  }
+};
+
 /** We're going to take in search space descriptions
  * as nested maps, which aren't efficient to
  * iterate across by index. These are very similar
@@ -412,6 +502,9 @@ class TeamSizeTuner : public ExtendableTunerMixin<TeamSizeTuner> {
       std::declval<SpaceDescription>(),
       std::declval<std::vector<std::string>>()));
   TunerType tuner;
+  std::string m_name;
+  std::vector<std::vector<int64_t>> m_default_candidates;
+  Impl::DefaultTunerState m_default_state;
 
  public:
   TeamSizeTuner()                                      = default;
@@ -424,7 +517,8 @@ class TeamSizeTuner : public ExtendableTunerMixin<TeamSizeTuner> {
   TeamSizeTuner(const std::string& name,
                 const Kokkos::TeamPolicy<Properties...>& policy_in,
                 const Functor& functor, const TagType& tag,
-                ViableConfigurationCalculator calc) {
+                ViableConfigurationCalculator calc)
+      : m_name(name) {
     using PolicyType = Kokkos::TeamPolicy<Properties...>;
     PolicyType policy(policy_in);
     auto initial_vector_length = policy.impl_vector_length();
@@ -501,6 +595,11 @@ class TeamSizeTuner : public ExtendableTunerMixin<TeamSizeTuner> {
       }
       space_description[vector_length] = allowed_team_sizes;
     }
+    for (const auto& [vector_length, team_sizes] : space_description) {
+      for (const auto team_size : team_sizes) {
+        m_default_candidates.push_back({vector_length, team_size});
+      }
+    }
     tuner = make_multidimensional_sparse_tuning_problem<20>(
         space_description, {std::string(name + "_vector_length"),
                             std::string(name + "_team_size")});
@@ -518,6 +617,16 @@ class TeamSizeTuner : public ExtendableTunerMixin<TeamSizeTuner> {
         policy.impl_set_team_size(team_size);
         policy.impl_set_vector_length(vector_length);
       }
+    } else if (Kokkos::Tools::Experimental::have_default_tuner()) {
+      const std::array<int64_t, 1> shape{policy.league_size()};
+      const auto& configuration = m_default_state.begin(
+          Impl::default_tuning_key(m_name, "team_size",
+                                   policy.space().concurrency(), shape),
+          [&]() { return m_default_candidates; });
+      if (!configuration.empty()) {
+        policy.impl_set_team_size(configuration[1]);
+        policy.impl_set_vector_length(configuration[0]);
+      }
     }
     return policy;
   }
@@ -525,6 +634,10 @@ class TeamSizeTuner : public ExtendableTunerMixin<TeamSizeTuner> {
     if (Kokkos::Tools::Experimental::have_tuning_tool()) {
       tuner.end();
     }
+    m_default_state.end();
+  }
+  bool impl_default_tuner_measuring() const {
+    return m_default_state.measuring();
   }
 
   TunerType get_tuner() const { return tuner; }
@@ -601,6 +714,8 @@ class RangePolicyOccupancyTuner {
  private:
   using TunerType = SingleDimensionalRangeTuner<int64_t>;
   TunerType tuner;
+  std::string m_name;
+  Impl::DefaultTunerState m_default_state;
 
  public:
   RangePolicyOccupancyTuner() = default;
@@ -613,7 +728,8 @@ class RangePolicyOccupancyTuner {
       : tuner(TunerType(name,
                         Kokkos::Tools::Experimental::StatisticalCategory::
                             kokkos_value_ratio,
-                        100, 5, 100, 5)) {}
+                        100, 5, 100, 5)),
+        m_name(name) {}
 
   template <typename... Properties>
   auto tune(const Kokkos::RangePolicy<Properties...>& policy_in) {
@@ -622,6 +738,26 @@ class RangePolicyOccupancyTuner {
       auto occupancy = tuner.begin();
       policy.impl_set_desired_occupancy(
           Kokkos::Experimental::DesiredOccupancy{static_cast<int>(occupancy)});
+    } else if (Kokkos::Tools::Experimental::have_default_tuner()) {
+      const std::array<int64_t, 1> shape{
+          static_cast<int64_t>(policy.end() - policy.begin())};
+      const auto& configuration = m_default_state.begin(
+          Impl::default_tuning_key(m_name, "occupancy",
+                                   policy.space().concurrency(), shape),
+          []() {
+            // same candidates as declared to tools, starting with the
+            // untuned default of 100%
+            std::vector<std::vector<int64_t>> candidates;
+            for (int64_t occupancy = 100; occupancy >= 5; occupancy -= 5) {
+              candidates.push_back({occupancy});
+            }
+            return candidates;
+          });
+      if (!configuration.empty()) {
+        policy.impl_set_desired_occupancy(
+            Kokkos::Experimental::DesiredOccupancy{
+                static_cast<int>(configuration[0])});
+      }
     }
     return policy;
   }
@@ -629,11 +765,71 @@ class RangePolicyOccupancyTuner {
     if (Kokkos::Tools::Experimental::have_tuning_tool()) {
       tuner.end();
     }
+    m_default_state.end();
+  }
+  bool impl_default_tuner_measuring() const {
+    return m_default_state.measuring();
   }
 
   TunerType get_tuner() const { return tuner; }
 };
 
+/** Tunes the chunk size of dynamically scheduled RangePolicies for which the
+ * user did not request a chunk size. Only the default tuner handles this
+ * problem, tools are not offered a tuning variable for it.
+ */
+class RangePolicyChunkSizeTuner {
+ private:
+  static constexpr int64_t max_chunk_size = 1 << 16;
+  std::string m_name;
+  Impl::DefaultTunerState m_default_state;
+
+ public:
+  RangePolicyChunkSizeTuner() = default;
+  template <typename ViableConfigurationCalculator, typename Functor,
+            typename TagType, typename... Properties>
+  RangePolicyChunkSizeTuner(const std::string& name,
+                            const Kokkos::RangePolicy<Properties...>&,
+                            const Functor&, const TagType&,
+                            ViableConfigurationCalculator)
+      : m_name(name) {}
+
+  template <typename... Properties>
+  auto tune(const Kokkos::RangePolicy<Properties...>& policy_in) {
+    Kokkos::RangePolicy<Properties...> policy(policy_in);
+    if (Kokkos::Tools::Experimental::have_default_tuner()) {
+      const int64_t length      = policy.end() - policy.begin();
+      const int64_t concurrency = std::max(policy.space().concurrency(), 1);
+      const std::array<int64_t, 1> shape{length};
+      const auto& configuration = m_default_state.begin(
+          Impl::default_tuning_key(m_name, "chunk_size", concurrency, shape),
+          [&]() {
+            // the heuristic choice first, then all powers of two up to an
+            // even share of the range per thread
+            std::vector<std::vector<int64_t>> candidates;
+            const int64_t heuristic = policy.chunk_size();
+            candidates.push_back({heuristic});
+            const int64_t largest =
+                std::min(std::max<int64_t>(length / concurrency, 1),
+                         max_chunk_size);
+            for (int64_t chunk_size = 1; chunk_size <= largest;
+                 chunk_size *= 2) {
+              if (chunk_size != heuristic) candidates.push_back({chunk_size});
+            }
+            return candidates;
+          });
+      if (!configuration.empty()) {
+        policy.impl_set_tuned_chunk_size(configuration[0]);
+      }
+    }
+    return policy;
+  }
+  void end() { m_default_state.end(); }
+  bool impl_default_tuner_measuring() const {
+    return m_default_state.measuring();
+  }
+};
+
 namespace Impl {
 
 template <typename T>
@@ -655,6 +851,8 @@ struct MDRangeTuner : public ExtendableTunerMixin<MDRangeTuner<MDRangeRank>> {
  private:
   static constexpr int rank       = MDRangeRank;
   static constexpr int max_slices = 15;
+  // upper bound on the number of tiles the default tuner explores per shape
+  static constexpr size_t max_default_candidates = 64;
   using SpaceDescription =
       typename Impl::n_dimensional_sparse_structure<int, rank>::type;
   using TunerType =
@@ -662,6 +860,47 @@ struct MDRangeTuner : public ExtendableTunerMixin<MDRangeTuner<MDRangeRank>> {
           std::declval<SpaceDescription>(),
           std::declval<std::vector<std::string>>()));
   TunerType tuner;
+  std::string m_name;
+  int64_t m_max_tile_size = 1;
+  Impl::DefaultTunerState m_default_state;
+
+  // Power-of-two tiles no larger than the extents (rounded up to a power of
+  // two) whose product does not exceed the maximum tile size
+  template <typename Extents>
+  void fill_default_candidates(const Extents& extents, int dimension,
+                               int64_t product, std::vector<int64_t>& tile,
+                               std::vector<std::vector<int64_t>>& out) const {
+    if (dimension == rank) {
+      out.push_back(tile);
+      return;
+    }
+    for (int64_t tile_size = 1;
+         product * tile_size <= m_max_tile_size &&
+         (tile_size == 1 || tile_size / 2 < extents[dimension]);
+         tile_size *= 2) {
+      tile[dimension] = tile_size;
+      fill_default_candidates(extents, dimension + 1, product * tile_size,
+                              tile, out);
+    }
+  }
+
+  template <typename Policy>
+  std::vector<std::vector<int64_t>> default_candidates(
+      const Policy& policy, const std::array<int64_t, rank>& extents) const {
+    std::vector<int64_t> tile(rank, 1);
+    std::vector<std::vector<int64_t>> all;
+    fill_default_candidates(extents, 0, 1, tile, all);
+    // the heuristic tile first, then an evenly spaced selection of the
+    // enumerated tiles
+    std::vector<std::vector<int64_t>> candidates;
+    candidates.emplace_back(policy.m_tile.data(), policy.m_tile.data() + rank);
+    const size_t stride =
+        (all.size() + max_default_candidates - 1) / max_default_candidates;
+    for (size_t i = 0; i < all.size(); i += stride) {
+      if (all[i] != candidates.front()) candidates.push_back(all[i]);
+    }
+    return candidates;
+  }
 
  public:
   MDRangeTuner() = default;
@@ -669,10 +908,12 @@ struct MDRangeTuner : public ExtendableTunerMixin<MDRangeTuner<MDRangeRank>> {
             typename... Properties>
   MDRangeTuner(const std::string& name,
                const Kokkos::MDRangePolicy<Properties...>& policy,
-               const Functor& functor, const TagType& tag, Calculator calc) {
+               const Functor& functor, const TagType& tag, Calculator calc)
+      : m_name(name) {
     SpaceDescription desc;
     int max_tile_size =
         calc.get_mdrange_max_tile_size_product(policy, functor, tag);
+    m_max_tile_size = max_tile_size;
     Impl::fill_tile(desc, max_tile_size);
     std::vector<std::string> feature_names;
     for (int x = 0; x < rank; ++x) {
@@ -692,6 +933,20 @@ struct MDRangeTuner : public ExtendableTunerMixin<MDRangeTuner<MDRangeRank>> {
     if (Kokkos::Tools::Experimental::have_tuning_tool()) {
       auto configuration = tuner.begin();
       set_policy_tile(policy, configuration, std::make_index_sequence<rank>{});
+    } else if (Kokkos::Tools::Experimental::have_default_tuner()) {
+      std::array<int64_t, rank> extents;
+      for (int i = 0; i < rank; ++i) {
+        extents[i] = policy.m_upper[i] - policy.m_lower[i];
+      }
+      const auto& configuration = m_default_state.begin(
+          Impl::default_tuning_key(m_name, "tile_size",
+                                   policy.space().concurrency(), extents),
+          [&]() { return default_candidates(policy, extents); });
+      if (configuration.size() == static_cast<size_t>(rank)) {
+        typename Kokkos::MDRangePolicy<Properties...>::tile_type tile;
+        for (int i = 0; i < rank; ++i) tile[i] = configuration[i];
+        policy.impl_change_tile_size(tile);
+      }
     }
     return policy;
   }
@@ -699,6 +954,10 @@ struct MDRangeTuner : public ExtendableTunerMixin<MDRangeTuner<MDRangeRank>> {
     if (Kokkos::Tools::Experimental::have_tuning_tool()) {
       tuner.end();
     }
+    m_default_state.end();
+  }
+  bool impl_default_tuner_measuring() const {
+    return m_default_state.measuring();
   }
 
   TunerType get_tuner() const { return tuner; }
@@ -129,8 +129,16 @@ class WorkGraphPolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
     return COMPLETED_TOKEN;
   }
 
-  KOKKOS_INLINE_FUNCTION
-  void completed_work(std::int32_t w) const noexcept {
+  /**\brief  Mark work index 'w' as completed.
+   *
+   *  Every work index that becomes ready, because 'w' was the last of its
+   *  predecessors, is first offered to 'take_ready'.  It is pushed to the
+   *  ready queue unless 'take_ready' returns true, e.g. when the calling
+   *  thread keeps it to run it next.
+   */
+  template <class TakeReady>
+  KOKKOS_INLINE_FUNCTION void completed_work(
+      std::int32_t w, TakeReady const& take_ready) const noexcept {
     Kokkos::memory_fence();
 
     // Make sure the completed work function's memory accesses are flushed.
@@ -144,12 +152,26 @@ class WorkGraphPolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
 
     for (std::int32_t i = B; i < E; ++i) {
       const std::int32_t j = m_graph.entries(i);
-      if (1 == atomic_fetch_add(count_queue + j, -1)) {
+      if (1 == atomic_fetch_add(count_queue + j, -1) && !take_ready(j)) {
         push_work(j);
       }
     }
   }
 
+  struct PushAllReady {
+    KOKKOS_INLINE_FUNCTION bool operator()(std::int32_t) const noexcept {
+      return false;
+    }
+  };
+
+  KOKKOS_INLINE_FUNCTION
+  void completed_work(std::int32_t w) const noexcept {
+    completed_work(w, PushAllReady{});
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  std::int32_t impl_work_count() const noexcept { return m_graph.numRows(); }
+
   struct TagInit {};
   struct TagCount {};
   struct TagReady {};
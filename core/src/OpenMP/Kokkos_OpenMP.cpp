@@ -24,6 +24,7 @@
 #include <OpenMP/Kokkos_OpenMP_Instance.hpp>
 
 #include <impl/Kokkos_ExecSpaceManager.hpp>
+#include <impl/Kokkos_GraphCapture.hpp>
 
 namespace Kokkos {
 
@@ -58,6 +59,11 @@ void OpenMP::impl_finalize() { Impl::OpenMPInternal::singleton().finalize(); }
 void OpenMP::print_configuration(std::ostream &os, bool /*verbose*/) const {
   os << "Host Parallel Execution Space:\n";
   os << "  KOKKOS_ENABLE_OPENMP: yes\n";
+#if defined(KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH)
+  os << "  KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH: yes\n";
+#else
+  os << "  KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH: no\n";
+#endif
 
   os << "\nOpenMP Runtime Configuration:\n";
 
@@ -78,6 +84,19 @@ void OpenMP::impl_static_fence(std::string const &name) {
       Kokkos::Tools::Experimental::SpecialSynchronizationCases::
           GlobalDeviceSynchronization,
       []() {
+#ifdef KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH
+        // Wait for the dispatched kernels without holding the lock on all
+        // instances, they may release the last reference to an instance.
+        std::vector<std::shared_ptr<Impl::OpenMPDispatchQueue>> queues;
+        {
+          std::lock_guard<std::mutex> lock_all_instances(
+              Impl::OpenMPInternal::all_instances_mutex);
+          for (auto *instance_ptr : Impl::OpenMPInternal::all_instances) {
+            queues.push_back(instance_ptr->dispatch_queue());
+          }
+        }
+        for (auto const &queue : queues) queue->wait();
+#endif
         std::lock_guard<std::mutex> lock_all_instances(
             Impl::OpenMPInternal::all_instances_mutex);
         for (auto *instance_ptr : Impl::OpenMPInternal::all_instances) {
@@ -88,10 +107,12 @@ void OpenMP::impl_static_fence(std::string const &name) {
 }
 
 void OpenMP::fence(const std::string &name) const {
+  Impl::graph_capture_fence(*this);
   Kokkos::Tools::Experimental::Impl::profile_fence_event<Kokkos::OpenMP>(
       name, Kokkos::Tools::Experimental::Impl::DirectFenceIDHandle{1},
       [this]() {
         auto *internal_instance = this->impl_internal_space_instance();
+        internal_instance->wait_for_dispatched();
         std::lock_guard<std::mutex> lock(internal_instance->m_instance_mutex);
       });
 }
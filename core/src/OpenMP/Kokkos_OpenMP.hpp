@@ -97,10 +97,14 @@ class OpenMP {
   /// \brief Does the given instance return immediately after launching
   /// a parallel algorithm
   ///
-  /// This always returns false on OpenMP
+  /// This returns true only if asynchronous dispatch is enabled on OpenMP
   KOKKOS_DEPRECATED inline static bool is_asynchronous(
       OpenMP const& = OpenMP()) noexcept {
+#if defined(KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH)
+    return true;
+#else
     return false;
+#endif
   }
 #endif
 
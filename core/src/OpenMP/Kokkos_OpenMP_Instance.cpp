@@ -26,14 +26,21 @@
 #include <impl/Kokkos_ExecSpaceManager.hpp>
 
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <thread>
 
 namespace {
 int g_openmp_hardware_max_threads = 1;
-}
+
+#ifdef KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH
+// Dispatch queue driven by the calling thread, if any
+thread_local Kokkos::Impl::OpenMPDispatchQueue *t_driven_queue = nullptr;
+#endif
+}  // namespace
 
 namespace Kokkos {
 namespace Impl {
@@ -41,6 +48,92 @@ namespace Impl {
 std::vector<OpenMPInternal *> OpenMPInternal::all_instances;
 std::mutex OpenMPInternal::all_instances_mutex;
 
+#ifdef KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH
+OpenMPDispatchQueue::~OpenMPDispatchQueue() { stop(); }
+
+void OpenMPDispatchQueue::submit(std::function<void()> &&work) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_stopped) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::OpenMP ERROR: dispatch to a finalized instance");
+  }
+  m_work.push_back(std::move(work));
+  if (!m_driver.joinable()) {
+    // the driver thread keeps the queue alive until it is done
+    m_driver = std::thread([self = shared_from_this()]() { self->drive(); });
+  }
+  m_work_available.notify_one();
+}
+
+void OpenMPDispatchQueue::wait() {
+  // work submitted from the driver thread runs inline
+  if (on_driver_thread()) return;
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_work_done.wait(lock, [this]() { return m_work.empty() && !m_busy; });
+  if (m_exception) {
+    std::exception_ptr exception = nullptr;
+    std::swap(exception, m_exception);
+    lock.unlock();
+    std::rethrow_exception(exception);
+  }
+}
+
+void OpenMPDispatchQueue::stop() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopped = true;
+    m_work_available.notify_one();
+  }
+  if (m_driver.joinable()) {
+    // the driver thread stops itself when it releases the last reference to
+    // its instance
+    if (on_driver_thread()) {
+      m_driver.detach();
+    } else {
+      m_driver.join();
+    }
+  }
+}
+
+bool OpenMPDispatchQueue::on_driver_thread() const noexcept {
+  return t_driven_queue == this;
+}
+
+void OpenMPDispatchQueue::drive() {
+  t_driven_queue = this;
+  // like the other threads executing kernels, the driver does not track
+  Impl::SharedAllocationRecord<void, void>::tracking_disable();
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_work_available.wait(lock,
+                          [this]() { return m_stopped || !m_work.empty(); });
+    // pending work is completed before stopping
+    if (m_work.empty()) break;
+
+    std::function<void()> work = std::move(m_work.front());
+    m_work.pop_front();
+    m_busy = true;
+    lock.unlock();
+
+    std::exception_ptr exception = nullptr;
+    try {
+      work();
+    } catch (...) {
+      exception = std::current_exception();
+    }
+    // release the closure before signaling completion
+    work = nullptr;
+
+    lock.lock();
+    if (exception && !m_exception) m_exception = exception;
+    m_busy = false;
+    if (m_work.empty()) m_work_done.notify_all();
+  }
+}
+#endif
+
 int OpenMPInternal::max_hardware_threads() noexcept {
   return g_openmp_hardware_max_threads;
 }
@@ -95,18 +188,14 @@ void OpenMPInternal::resize_thread_data(size_t pool_reduce_bytes,
                         (old_thread_local < thread_local_bytes);
 
   if (allocate) {
-    if (pool_reduce_bytes < old_pool_reduce) {
-      pool_reduce_bytes = old_pool_reduce;
-    }
-    if (team_reduce_bytes < old_team_reduce) {
-      team_reduce_bytes = old_team_reduce;
-    }
-    if (team_shared_bytes < old_team_shared) {
-      team_shared_bytes = old_team_shared;
-    }
-    if (thread_local_bytes < old_thread_local) {
-      thread_local_bytes = old_thread_local;
-    }
+    pool_reduce_bytes  = HostThreadTeamData::scratch_high_water_mark(
+        old_pool_reduce, pool_reduce_bytes);
+    team_reduce_bytes  = HostThreadTeamData::scratch_high_water_mark(
+        old_team_reduce, team_reduce_bytes);
+    team_shared_bytes  = HostThreadTeamData::scratch_high_water_mark(
+        old_team_shared, team_shared_bytes);
+    thread_local_bytes = HostThreadTeamData::scratch_high_water_mark(
+        old_thread_local, thread_local_bytes);
 
     const size_t alloc_bytes =
         member_bytes +
@@ -117,6 +206,8 @@ void OpenMPInternal::resize_thread_data(size_t pool_reduce_bytes,
 
     memory_fence();
 
+    void *ptrs[OpenMPTraits::MAX_THREAD_COUNT];
+
     for (int rank = 0; rank < m_pool_size; ++rank) {
       if (nullptr != m_pool[rank]) {
         m_pool[rank]->disband_pool();
@@ -125,16 +216,39 @@ void OpenMPInternal::resize_thread_data(size_t pool_reduce_bytes,
         space.impl_deallocate("[unlabeled]", m_pool[rank], old_alloc_bytes);
       }
 
-      void *ptr = space.allocate("Kokkos::OpenMP::scratch_mem", alloc_bytes);
+      ptrs[rank] = space.allocate("Kokkos::OpenMP::scratch_mem", alloc_bytes);
+    }
+
+    // The thread that uses the memory of a rank is the first to touch it, so
+    // that it is placed on the NUMA domain of that thread.  The ranks of the
+    // threads missing from a nested parallel region are set up by the others.
+    // Only the members and the reduce areas are touched here, team-shared and
+    // thread-local scratch are left to the kernels that use them so that the
+    // pages they never use are not committed.
+#pragma omp parallel num_threads(m_pool_size)
+    {
+      for (int rank = omp_get_thread_num(); rank < m_pool_size;
+           rank += omp_get_num_threads()) {
+        char *const ptr = static_cast<char *>(ptrs[rank]);
 
-      m_pool[rank] = new (ptr) HostThreadTeamData();
+        m_pool[rank] = new (ptr) HostThreadTeamData();
 
-      m_pool[rank]->scratch_assign(((char *)ptr) + member_bytes, alloc_bytes,
-                                   pool_reduce_bytes, team_reduce_bytes,
-                                   team_shared_bytes, thread_local_bytes);
+        m_pool[rank]->scratch_assign(ptr + member_bytes, alloc_bytes,
+                                     pool_reduce_bytes, team_reduce_bytes,
+                                     team_shared_bytes, thread_local_bytes);
+
+        const size_t reduce_bytes = m_pool[rank]->scratch_bytes() -
+                                    m_pool[rank]->team_shared_bytes() -
+                                    m_pool[rank]->thread_local_bytes();
+        std::memset(ptr + member_bytes, 0, reduce_bytes);
+      }
     }
 
     HostThreadTeamData::organize_pool(m_pool, m_pool_size);
+
+    Kokkos::Tools::resizeScratch(
+        Kokkos::Tools::make_space_handle(space.name()),
+        m_pool_size * old_alloc_bytes, m_pool_size * alloc_bytes);
   }
 }
 
@@ -277,6 +391,10 @@ void OpenMPInternal::finalize() {
     Kokkos::Impl::throw_runtime_exception(msg);
   }
 
+#ifdef KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH
+  m_dispatch_queue->stop();
+#endif
+
   if (this == &singleton()) {
     auto const &instance = singleton();
     // Silence Cuda Warning
@@ -309,6 +427,22 @@ void OpenMPInternal::finalize() {
   }
 }
 
+double OpenMPInternal::fork_join_overhead() {
+  if (m_fork_join_overhead < 0.) {
+    // the fastest of a few empty parallel regions, after a warm-up one
+    double overhead = std::numeric_limits<double>::max();
+    for (int i = 0; i < 8; ++i) {
+      Kokkos::Timer timer;
+#pragma omp parallel num_threads(m_pool_size)
+      {
+      }
+      if (i > 0) overhead = std::min(overhead, timer.seconds());
+    }
+    m_fork_join_overhead = overhead;
+  }
+  return m_fork_join_overhead;
+}
+
 void OpenMPInternal::print_configuration(std::ostream &s) const {
   s << "Kokkos::OpenMP";
 
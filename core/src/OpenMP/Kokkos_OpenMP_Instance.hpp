@@ -28,8 +28,10 @@
 
 #include <impl/Kokkos_Traits.hpp>
 #include <impl/Kokkos_HostThreadTeam.hpp>
+#include <impl/Kokkos_HostSerialThreshold.hpp>
 
 #include <Kokkos_Atomic.hpp>
+#include <Kokkos_Timer.hpp>
 
 #include <impl/Kokkos_ConcurrentBitset.hpp>
 
@@ -40,6 +42,15 @@
 #include <type_traits>
 #include <vector>
 
+#ifdef KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <thread>
+#endif
+
 /*--------------------------------------------------------------------------*/
 
 namespace Kokkos {
@@ -51,6 +62,40 @@ struct OpenMPTraits {
   static constexpr int MAX_THREAD_COUNT = 512;
 };
 
+#ifdef KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH
+// Kernels submitted to an OpenMP instance, executed in submission order by a
+// driver thread owned by the queue. The driver thread is started on the first
+// submission and keeps the queue alive until it is stopped, so that the last
+// reference to an instance may be released by a kernel running on it.
+class OpenMPDispatchQueue
+    : public std::enable_shared_from_this<OpenMPDispatchQueue> {
+ public:
+  ~OpenMPDispatchQueue();
+
+  void submit(std::function<void()>&& work);
+
+  // Wait for all submitted work to complete. Exceptions thrown by the work
+  // are rethrown here.
+  void wait();
+
+  void stop();
+
+  bool on_driver_thread() const noexcept;
+
+ private:
+  void drive();
+
+  std::mutex m_mutex;
+  std::condition_variable m_work_available;
+  std::condition_variable m_work_done;
+  std::deque<std::function<void()>> m_work;
+  std::exception_ptr m_exception;
+  std::thread m_driver;
+  bool m_busy    = false;
+  bool m_stopped = false;
+};
+#endif
+
 class OpenMPInternal {
  private:
   OpenMPInternal(int arg_pool_size)
@@ -70,9 +115,15 @@ class OpenMPInternal {
 
   int m_pool_size;
   int m_level;
+  double m_fork_join_overhead = -1.;
 
   HostThreadTeamData* m_pool[OpenMPTraits::MAX_THREAD_COUNT];
 
+#ifdef KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH
+  std::shared_ptr<OpenMPDispatchQueue> m_dispatch_queue =
+      std::make_shared<OpenMPDispatchQueue>();
+#endif
+
  public:
   friend class Kokkos::OpenMP;
 
@@ -101,31 +152,114 @@ class OpenMPInternal {
 
   int get_level() const { return m_level; }
 
+  // Time in seconds to fork and join the thread pool of this instance,
+  // measured on first use. Must be called outside of a parallel region
+  // while holding m_instance_mutex.
+  double fork_join_overhead();
+
   bool is_initialized() const { return m_initialized; }
 
   bool verify_is_initialized(const char* const label) const;
 
   void print_configuration(std::ostream& s) const;
 
+  // Run the closure on this instance. With asynchronous dispatch the closure
+  // is copied and queued to the driver thread of the instance, unless called
+  // from within a parallel region or from the driver thread itself.
+  template <class Closure>
+  void dispatch(Closure const& closure) {
+#ifdef KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH
+    if (!omp_in_parallel() && !m_dispatch_queue->on_driver_thread()) {
+      m_dispatch_queue->submit([closure]() { closure.impl_execute(); });
+      return;
+    }
+#endif
+    closure.impl_execute();
+  }
+
+  // Wait for the kernels dispatched to this instance
+  void wait_for_dispatched() const {
+#ifdef KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH
+    m_dispatch_queue->wait();
+#endif
+  }
+
+#ifdef KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH
+  std::shared_ptr<OpenMPDispatchQueue> dispatch_queue() const {
+    return m_dispatch_queue;
+  }
+#endif
+
   std::mutex m_instance_mutex;
 
   static std::vector<OpenMPInternal*> all_instances;
   static std::mutex all_instances_mutex;
 };
 
-inline bool execute_in_serial(OpenMP const& space = OpenMP()) {
+inline bool is_nested_parallelism_enabled() {
 // The default value returned by `omp_get_max_active_levels` with gcc version
 // lower than 11.1.0 is 2147483647 instead of 1.
 #if (!defined(KOKKOS_COMPILER_GNU) || KOKKOS_COMPILER_GNU >= 1110) && \
     _OPENMP >= 201511
-  bool is_nested = omp_get_max_active_levels() > 1;
+  return omp_get_max_active_levels() > 1;
 #else
-  bool is_nested = static_cast<bool>(omp_get_nested());
+  return static_cast<bool>(omp_get_nested());
 #endif
+}
+
+inline bool execute_in_serial(OpenMP const& space = OpenMP()) {
   return (space.impl_internal_space_instance()->get_level() < omp_get_level() &&
-          !(is_nested && (omp_get_level() == 1)));
+          !(is_nested_parallelism_enabled() && (omp_get_level() == 1)));
 }
 
+// Decides whether a RangePolicy launch runs serially on the calling thread
+// because it is too short to be worth using the thread pool, see
+// RangePolicy::set_serial_threshold. When the threshold is learned, the
+// duration of the launch is recorded at the end of the scope.
+class OpenMPSerialThresholdScope {
+  HostSerialThreshold* m_learned = nullptr;
+  int64_t m_length               = 0;
+  int m_pool_size                = 1;
+  double m_overhead              = 0.;
+  bool m_serial;
+  Kokkos::Timer m_timer;
+
+ public:
+  template <class Policy>
+  OpenMPSerialThresholdScope(OpenMPInternal& instance, const Policy& policy,
+                             bool serial)
+      : m_serial(serial) {
+    if (m_serial) return;
+    m_length = policy.end() - policy.begin();
+    if (policy.serial_threshold() >= 0) {
+      m_serial = m_length < policy.serial_threshold();
+      return;
+    }
+    m_learned = policy.impl_serial_threshold_state();
+    if (!m_learned) return;
+    m_pool_size = instance.thread_pool_size();
+    m_overhead  = instance.fork_join_overhead();
+    m_serial    = m_length < m_learned->threshold(m_overhead, m_pool_size);
+    m_timer.reset();
+  }
+
+  ~OpenMPSerialThresholdScope() {
+    if (!m_learned) return;
+    const double seconds = m_timer.seconds();
+    if (m_serial) {
+      m_learned->record_serial(m_length, seconds);
+    } else {
+      m_learned->record_parallel(m_length, m_pool_size, m_overhead, seconds);
+    }
+  }
+
+  OpenMPSerialThresholdScope(OpenMPSerialThresholdScope const&) = delete;
+  OpenMPSerialThresholdScope& operator=(OpenMPSerialThresholdScope const&) =
+      delete;
+
+  bool serial() const { return m_serial; }
+};
+
 }  // namespace Impl
 
 namespace Experimental {
@@ -107,10 +107,14 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
   }
 
  public:
-  inline void execute() const {
+  inline void execute() const { m_instance->dispatch(*this); }
+
+  inline void impl_execute() const {
     // Serialize kernels on the same execution space instance
     std::lock_guard<std::mutex> lock(m_instance->m_instance_mutex);
-    if (execute_in_serial(m_policy.space())) {
+    const OpenMPSerialThresholdScope serial_threshold(
+        *m_instance, m_policy, execute_in_serial(m_policy.space()));
+    if (serial_threshold.serial()) {
       exec_range(m_functor, m_policy.begin(), m_policy.end());
       return;
     }
@@ -203,7 +207,9 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
   }
 
  public:
-  inline void execute() const {
+  inline void execute() const { m_instance->dispatch(*this); }
+
+  inline void impl_execute() const {
     // Serialize kernels on the same execution space instance
     std::lock_guard<std::mutex> lock(m_instance->m_instance_mutex);
 
@@ -330,7 +336,9 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
   }
 
  public:
-  inline void execute() const {
+  inline void execute() const { m_instance->dispatch(*this); }
+
+  inline void impl_execute() const {
     enum { is_dynamic = std::is_same<SchedTag, Kokkos::Dynamic>::value };
 
     const size_t pool_reduce_size  = 0;  // Never shrinks
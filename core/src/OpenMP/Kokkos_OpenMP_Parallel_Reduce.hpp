@@ -20,6 +20,8 @@
 #include <omp.h>
 #include <OpenMP/Kokkos_OpenMP_Instance.hpp>
 #include <KokkosExp_MDRangePolicy.hpp>
+#include <impl/Kokkos_HostReproducibleReduce.hpp>
+#include <impl/Kokkos_HostSlicedJoin.hpp>
 
 namespace Kokkos {
 namespace Impl {
@@ -27,6 +29,9 @@ namespace Impl {
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
+template <>
+struct SupportsReproducibleReduce<Kokkos::OpenMP> : std::true_type {};
+
 template <class CombinedFunctorReducerType, class... Traits>
 class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
                      Kokkos::OpenMP> {
@@ -40,6 +45,7 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
 
   using pointer_type   = typename ReducerType::pointer_type;
   using reference_type = typename ReducerType::reference_type;
+  using value_type     = typename ReducerType::value_type;
 
   OpenMPInternal* m_instance;
   const CombinedFunctorReducerType m_functor_reducer;
@@ -65,8 +71,38 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
     }
   }
 
+  inline void execute_reproducible() const {
+    const HostReproducibleReduce<Policy, ReducerType> reproducible(
+        m_policy, m_functor_reducer.get_reducer());
+
+    const auto exec_block = [&](const int64_t block) {
+      reproducible.exec_block(
+          block, [&](const Member ibeg, const Member iend,
+                     reference_type update) {
+            ParallelReduce::template exec_range<WorkTag>(
+                m_functor_reducer.get_functor(), ibeg, iend, update);
+          });
+    };
+
+    const int64_t num_blocks = reproducible.num_blocks();
+    if (execute_in_serial(m_policy.space())) {
+      for (int64_t block = 0; block < num_blocks; ++block) exec_block(block);
+    } else {
+#pragma omp parallel for schedule(dynamic, 1) \
+    num_threads(m_instance->thread_pool_size())
+      for (int64_t block = 0; block < num_blocks; ++block) exec_block(block);
+    }
+
+    reproducible.join(m_result_ptr
+                          ? m_result_ptr
+                          : pointer_type(m_instance->get_thread_data(0)
+                                             ->pool_reduce_local()));
+  }
+
  public:
-  inline void execute() const {
+  inline void execute() const { m_instance->dispatch(*this); }
+
+  inline void impl_execute() const {
     const ReducerType& reducer = m_functor_reducer.get_reducer();
 
     if (m_policy.end() <= m_policy.begin()) {
@@ -93,7 +129,14 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
                                    0  // thread_local_bytes
     );
 
-    if (execute_in_serial(m_policy.space())) {
+    if constexpr (Policy::is_reproducible::value) {
+      execute_reproducible();
+      return;
+    }
+
+    const OpenMPSerialThresholdScope serial_threshold(
+        *m_instance, m_policy, execute_in_serial(m_policy.space()));
+    if (serial_threshold.serial()) {
       const pointer_type ptr =
           m_result_ptr
               ? m_result_ptr
@@ -111,6 +154,11 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
       return;
     }
     const int pool_size = m_instance->thread_pool_size();
+    const HostSlicedJoin sliced_join(
+        host_reducer_has_elementwise_join_v<ReducerType>
+            ? reducer.value_count()
+            : 0,
+        pool_size);
 #pragma omp parallel num_threads(pool_size)
     {
       HostThreadTeamData& data = *(m_instance->get_thread_data());
@@ -137,6 +185,17 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
             range.second + m_policy.begin(), update);
 
       } while (is_dynamic && 0 <= range.first);
+
+      if constexpr (host_reducer_has_elementwise_join_v<ReducerType>) {
+        if (sliced_join.is_parallel()) {
+#pragma omp barrier
+          sliced_join.template join<value_type>(
+              data.pool_rank(), pool_size, [&](int i) {
+                return reinterpret_cast<pointer_type>(
+                    m_instance->get_thread_data(i)->pool_reduce_local());
+              });
+        }
+      }
     }
 
     // Reduction:
@@ -144,10 +203,12 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
     const pointer_type ptr =
         pointer_type(m_instance->get_thread_data(0)->pool_reduce_local());
 
-    for (int i = 1; i < pool_size; ++i) {
-      reducer.join(ptr,
-                   reinterpret_cast<pointer_type>(
-                       m_instance->get_thread_data(i)->pool_reduce_local()));
+    if (!sliced_join.is_parallel()) {
+      for (int i = 1; i < pool_size; ++i) {
+        reducer.join(ptr,
+                     reinterpret_cast<pointer_type>(
+                         m_instance->get_thread_data(i)->pool_reduce_local()));
+      }
     }
 
     reducer.final(ptr);
@@ -214,7 +275,9 @@ class ParallelReduce<CombinedFunctorReducerType,
   }
 
  public:
-  inline void execute() const {
+  inline void execute() const { m_instance->dispatch(*this); }
+
+  inline void impl_execute() const {
     const ReducerType& reducer     = m_iter.m_func.get_reducer();
     const size_t pool_reduce_bytes = reducer.value_size();
 
@@ -252,6 +315,11 @@ class ParallelReduce<CombinedFunctorReducerType,
     };
 
     const int pool_size = m_instance->thread_pool_size();
+    const HostSlicedJoin sliced_join(
+        host_reducer_has_elementwise_join_v<ReducerType>
+            ? reducer.value_count()
+            : 0,
+        pool_size);
 #pragma omp parallel num_threads(pool_size)
     {
       HostThreadTeamData& data = *(m_instance->get_thread_data());
@@ -275,6 +343,17 @@ class ParallelReduce<CombinedFunctorReducerType,
         ParallelReduce::exec_range(range.first, range.second, update);
 
       } while (is_dynamic && 0 <= range.first);
+
+      if constexpr (host_reducer_has_elementwise_join_v<ReducerType>) {
+        if (sliced_join.is_parallel()) {
+#pragma omp barrier
+          sliced_join.template join<value_type>(
+              data.pool_rank(), pool_size, [&](int i) {
+                return reinterpret_cast<pointer_type>(
+                    m_instance->get_thread_data(i)->pool_reduce_local());
+              });
+        }
+      }
     }
     // END #pragma omp parallel
 
@@ -283,10 +362,12 @@ class ParallelReduce<CombinedFunctorReducerType,
     const pointer_type ptr =
         pointer_type(m_instance->get_thread_data(0)->pool_reduce_local());
 
-    for (int i = 1; i < pool_size; ++i) {
-      reducer.join(ptr,
-                   reinterpret_cast<pointer_type>(
-                       m_instance->get_thread_data(i)->pool_reduce_local()));
+    if (!sliced_join.is_parallel()) {
+      for (int i = 1; i < pool_size; ++i) {
+        reducer.join(ptr,
+                     reinterpret_cast<pointer_type>(
+                         m_instance->get_thread_data(i)->pool_reduce_local()));
+      }
     }
 
     reducer.final(ptr);
@@ -393,7 +474,9 @@ class ParallelReduce<CombinedFunctorReducerType,
   }
 
  public:
-  inline void execute() const {
+  inline void execute() const { m_instance->dispatch(*this); }
+
+  inline void impl_execute() const {
     enum { is_dynamic = std::is_same<SchedTag, Kokkos::Dynamic>::value };
 
     const ReducerType& reducer = m_functor_reducer.get_reducer();
@@ -66,7 +66,9 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
   }
 
  public:
-  inline void execute() const {
+  inline void execute() const { m_instance->dispatch(*this); }
+
+  inline void impl_execute() const {
     const int value_count          = Analysis::value_count(m_functor);
     const size_t pool_reduce_bytes = 2 * Analysis::value_size(m_functor);
 
@@ -192,7 +194,9 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
   }
 
  public:
-  inline void execute() const {
+  inline void execute() const { m_instance->dispatch(*this); }
+
+  inline void impl_execute() const {
     const int value_count          = Analysis::value_count(m_functor);
     const size_t pool_reduce_bytes = 2 * Analysis::value_size(m_functor);
 
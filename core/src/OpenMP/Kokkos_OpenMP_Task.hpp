@@ -25,9 +25,12 @@
 
 #include <impl/Kokkos_HostThreadTeam.hpp>
 #include <OpenMP/Kokkos_OpenMP.hpp>
+#include <Kokkos_DetectionIdiom.hpp>
+#include <Kokkos_Timer.hpp>
 
 #include <type_traits>
 #include <cassert>
+#include <sstream>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
@@ -44,6 +47,10 @@ class HostThreadTeamDataSingleton : private HostThreadTeamData {
   static HostThreadTeamData& singleton();
 };
 
+template <class QueueType>
+using task_queue_statistics_t =
+    decltype(std::declval<QueueType const&>().impl_statistics());
+
 // Hack this as a partial specialization for now
 // TODO @tasking @cleanup DSH Make this the general class template and make the
 // old code the partial specialization
@@ -73,6 +80,9 @@ class TaskQueueSpecialization<SimpleTaskScheduler<Kokkos::OpenMP, QueueType>> {
         execution_space().impl_internal_space_instance();
     const int pool_size = get_max_team_count(scheduler.get_execution_space());
 
+    // Tasks are executed synchronously, after the dispatched kernels
+    instance->wait_for_dispatched();
+
     // Serialize kernels on the same execution space instance
     std::lock_guard<std::mutex> lock(instance->m_instance_mutex);
 
@@ -89,8 +99,22 @@ class TaskQueueSpecialization<SimpleTaskScheduler<Kokkos::OpenMP, QueueType>> {
 
     // queue.initialize_team_queues(pool_size / team_size);
 
+    // Idle time and work stealing statistics are reported to the tools
+    const bool record_statistics = Kokkos::Tools::profileLibraryLoaded();
+    double idle_seconds          = 0.0;
+
+    [[maybe_unused]] detected_or_t<int, task_queue_statistics_t, QueueType>
+        stats_before{};
+    if constexpr (is_detected_v<task_queue_statistics_t, QueueType>) {
+      if (record_statistics) stats_before = queue.impl_statistics();
+    }
+
 #pragma omp parallel num_threads(pool_size)
     {
+      double thread_idle_seconds = 0.0;
+      bool idle                  = false;
+      Kokkos::Timer idle_timer;
+
       Impl::HostThreadTeamData& self = *(instance->get_thread_data());
 
       // Organizing threads into a team performs a barrier across the
@@ -117,6 +141,12 @@ class TaskQueueSpecialization<SimpleTaskScheduler<Kokkos::OpenMP, QueueType>> {
               current_task =
                   queue.pop_ready_task(team_scheduler.team_scheduler_info());
 
+              if (record_statistics && bool(current_task) == idle) {
+                if (idle) thread_idle_seconds += idle_timer.seconds();
+                idle_timer.reset();
+                idle = !idle;
+              }
+
               if (current_task) {
                 if (current_task->is_team_runnable()) {
                   // break out of the team leader loop to run the team task
@@ -152,7 +182,24 @@ class TaskQueueSpecialization<SimpleTaskScheduler<Kokkos::OpenMP, QueueType>> {
         }
       }
       self.disband_team();
+
+      if (idle) thread_idle_seconds += idle_timer.seconds();
+#pragma omp atomic
+      idle_seconds += thread_idle_seconds;
     }  // end pragma omp parallel
+
+    if (record_statistics) {
+      std::ostringstream msg;
+      msg << "Kokkos::OpenMP TaskScheduler: " << idle_seconds
+          << " s idle time summed over " << pool_size << " threads";
+      if constexpr (is_detected_v<task_queue_statistics_t, QueueType>) {
+        const auto stats = queue.impl_statistics();
+        msg << ", " << stats.steals - stats_before.steals << " tasks stolen, "
+            << stats.failed_steals - stats_before.failed_steals
+            << " failed steal attempts";
+      }
+      Kokkos::Tools::markEvent(msg.str());
+    }
   }
 
   static uint32_t get_max_team_count(execution_space const& espace) {
@@ -237,6 +284,9 @@ class TaskQueueSpecializationConstrained<
         execution_space().impl_internal_space_instance();
     const int pool_size = instance->thread_pool_size();
 
+    // Tasks are executed synchronously, after the dispatched kernels
+    instance->wait_for_dispatched();
+
     // Serialize kernels on the same execution space instance
     std::lock_guard<std::mutex> lock(instance->m_instance_mutex);
 
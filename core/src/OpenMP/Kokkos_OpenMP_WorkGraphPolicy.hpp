@@ -18,6 +18,7 @@
 #define KOKKOS_OPENMP_WORKGRAPHPOLICY_HPP
 
 #include <OpenMP/Kokkos_OpenMP.hpp>
+#include <impl/Kokkos_HostWorkGraphQueue.hpp>
 
 namespace Kokkos {
 namespace Impl {
@@ -51,18 +52,14 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
     // from HIP
     OpenMP exec;
     [[maybe_unused]] int pool_size = exec.impl_thread_pool_size();
+    // The work graph is executed synchronously, after the dispatched kernels
+    exec.impl_internal_space_instance()->wait_for_dispatched();
+    HostWorkGraphQueue<Policy> queue(m_policy, pool_size);
 #pragma omp parallel num_threads(pool_size)
     {
-      // Spin until COMPLETED_TOKEN.
-      // END_TOKEN indicates no work is currently available.
-
-      for (std::int32_t w = Policy::END_TOKEN;
-           Policy::COMPLETED_TOKEN != (w = m_policy.pop_work());) {
-        if (Policy::END_TOKEN != w) {
-          exec_one<typename Policy::work_tag>(w);
-          m_policy.completed_work(w);
-        }
-      }
+      queue.execute(omp_get_thread_num(), [this](const std::int32_t w) {
+        exec_one<typename Policy::work_tag>(w);
+      });
     }
   }
 
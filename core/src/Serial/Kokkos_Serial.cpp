@@ -125,18 +125,14 @@ void SerialInternal::resize_thread_team_data(size_t pool_reduce_bytes,
                             m_thread_team_data.scratch_bytes());
     }
 
-    if (pool_reduce_bytes < old_pool_reduce) {
-      pool_reduce_bytes = old_pool_reduce;
-    }
-    if (team_reduce_bytes < old_team_reduce) {
-      team_reduce_bytes = old_team_reduce;
-    }
-    if (team_shared_bytes < old_team_shared) {
-      team_shared_bytes = old_team_shared;
-    }
-    if (thread_local_bytes < old_thread_local) {
-      thread_local_bytes = old_thread_local;
-    }
+    pool_reduce_bytes  = HostThreadTeamData::scratch_high_water_mark(
+        old_pool_reduce, pool_reduce_bytes);
+    team_reduce_bytes  = HostThreadTeamData::scratch_high_water_mark(
+        old_team_reduce, team_reduce_bytes);
+    team_shared_bytes  = HostThreadTeamData::scratch_high_water_mark(
+        old_team_shared, team_shared_bytes);
+    thread_local_bytes = HostThreadTeamData::scratch_high_water_mark(
+        old_thread_local, thread_local_bytes);
 
     const size_t alloc_bytes =
         HostThreadTeamData::scratch_size(pool_reduce_bytes, team_reduce_bytes,
@@ -144,6 +140,9 @@ void SerialInternal::resize_thread_team_data(size_t pool_reduce_bytes,
 
     void* ptr = space.allocate("Kokkos::Serial::scratch_mem", alloc_bytes);
 
+    Kokkos::Tools::resizeScratch(Kokkos::Tools::make_space_handle(space.name()),
+                                 old_alloc_bytes, alloc_bytes);
+
     m_thread_team_data.scratch_assign(static_cast<char*>(ptr), alloc_bytes,
                                       pool_reduce_bytes, team_reduce_bytes,
                                       team_shared_bytes, thread_local_bytes);
@@ -18,6 +18,7 @@
 #define KOKKOS_SERIAL_PARALLEL_RANGE_HPP
 
 #include <Kokkos_Parallel.hpp>
+#include <impl/Kokkos_HostReproducibleReduce.hpp>
 
 namespace Kokkos {
 namespace Impl {
@@ -62,6 +63,9 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::Serial> {
 
 /*--------------------------------------------------------------------------*/
 
+template <>
+struct SupportsReproducibleReduce<Kokkos::Serial> : std::true_type {};
+
 template <class CombinedFunctorReducerType, class... Traits>
 class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
                      Kokkos::Serial> {
@@ -78,22 +82,22 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
   const Policy m_policy;
   const pointer_type m_result_ptr;
 
+  using Member = typename Policy::member_type;
+
   template <class TagType>
   inline std::enable_if_t<std::is_void_v<TagType>> exec(
-      reference_type update) const {
-    const typename Policy::member_type e = m_policy.end();
-    for (typename Policy::member_type i = m_policy.begin(); i < e; ++i) {
+      const Member ibeg, const Member iend, reference_type update) const {
+    for (Member i = ibeg; i < iend; ++i) {
       m_functor_reducer.get_functor()(i, update);
     }
   }
 
   template <class TagType>
   inline std::enable_if_t<!std::is_void_v<TagType>> exec(
-      reference_type update) const {
+      const Member ibeg, const Member iend, reference_type update) const {
     const TagType t{};
 
-    const typename Policy::member_type e = m_policy.end();
-    for (typename Policy::member_type i = m_policy.begin(); i < e; ++i) {
+    for (Member i = ibeg; i < iend; ++i) {
       m_functor_reducer.get_functor()(t, i, update);
     }
   }
@@ -122,9 +126,24 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
             : pointer_type(
                   internal_instance->m_thread_team_data.pool_reduce_local());
 
+    if constexpr (Policy::is_reproducible::value) {
+      // Same blocks and join order as the threaded host backends
+      const HostReproducibleReduce<Policy, ReducerType> reproducible(
+          m_policy, m_functor_reducer.get_reducer());
+      for (int64_t block = 0; block < reproducible.num_blocks(); ++block) {
+        reproducible.exec_block(
+            block, [&](const Member ibeg, const Member iend,
+                       reference_type update) {
+              this->template exec<WorkTag>(ibeg, iend, update);
+            });
+      }
+      reproducible.join(ptr);
+      return;
+    }
+
     reference_type update = m_functor_reducer.get_reducer().init(ptr);
 
-    this->template exec<WorkTag>(update);
+    this->template exec<WorkTag>(m_policy.begin(), m_policy.end(), update);
 
     m_functor_reducer.get_reducer().final(ptr);
   }
@@ -30,6 +30,7 @@
 
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_CPUDiscovery.hpp>
+#include <impl/Kokkos_HostThreadTeam.hpp>
 #include <impl/Kokkos_Tools.hpp>
 #include <impl/Kokkos_ExecSpaceManager.hpp>
 
@@ -392,17 +393,40 @@ void *ThreadsInternal::resize_scratch(size_t reduce_size, size_t thread_size) {
 
   // Increase size or deallocate completely.
 
-  if ((old_reduce_size < reduce_size) || (old_thread_size < thread_size) ||
-      ((reduce_size == 0 && thread_size == 0) &&
-       (old_reduce_size != 0 || old_thread_size != 0))) {
+  if ((reduce_size == 0 && thread_size == 0) &&
+      (old_reduce_size != 0 || old_thread_size != 0)) {
     verify_is_process("ThreadsInternal::resize_scratch", true);
 
+    s_threads_process.m_scratch_reduce_end = 0;
+    s_threads_process.m_scratch_thread_end = 0;
+
+    execute_resize_scratch_in_serial();
+
+    s_threads_process.m_scratch = nullptr;
+  } else if ((old_reduce_size < reduce_size) ||
+             (old_thread_size < thread_size)) {
+    verify_is_process("ThreadsInternal::resize_scratch", true);
+
+    // Keep the part that is large enough, so that kernels alternating between
+    // reduction and team scratch needs do not reallocate at every launch
+    reduce_size = HostThreadTeamData::scratch_high_water_mark(old_reduce_size,
+                                                              reduce_size);
+    thread_size = HostThreadTeamData::scratch_high_water_mark(old_thread_size,
+                                                              thread_size);
+    reduce_size = (reduce_size + ALIGN_MASK) & ~ALIGN_MASK;
+    thread_size = (thread_size + ALIGN_MASK) & ~ALIGN_MASK;
+
     s_threads_process.m_scratch_reduce_end = reduce_size;
     s_threads_process.m_scratch_thread_end = reduce_size + thread_size;
 
     execute_resize_scratch_in_serial();
 
     s_threads_process.m_scratch = s_threads_exec[0]->m_scratch;
+
+    Kokkos::Tools::resizeScratch(
+        Kokkos::Tools::make_space_handle(Kokkos::HostSpace::name()),
+        s_thread_pool_size[0] * (old_reduce_size + old_thread_size),
+        s_thread_pool_size[0] * (reduce_size + thread_size));
   }
 
   return s_threads_process.m_scratch;
@@ -678,6 +702,7 @@ int Threads::concurrency() const { return impl_thread_pool_size(0); }
 #endif
 
 void Threads::fence(const std::string &name) const {
+  Impl::graph_capture_fence(*this);
   Impl::ThreadsInternal::fence(name);
 }
 
@@ -27,6 +27,7 @@
 #include <Kokkos_Pair.hpp>
 
 #include <impl/Kokkos_ConcurrentBitset.hpp>
+#include <impl/Kokkos_HostSlicedJoin.hpp>
 #include <Threads/Kokkos_Threads.hpp>
 #include <Threads/Kokkos_Threads_Spinwait.hpp>
 #include <Threads/Kokkos_Threads_State.hpp>
@@ -200,7 +201,15 @@ class ThreadsInternal {
   // All-thread functions:
 
   template <class FunctorType>
-  inline void fan_in_reduce(const FunctorType &f) const {
+  inline void fan_in_reduce(const FunctorType &f) {
+    if constexpr (host_reducer_has_elementwise_join_v<FunctorType>) {
+      const HostSlicedJoin sliced_join(f.value_count(), m_pool_size);
+      if (sliced_join.is_parallel()) {
+        fan_in_reduce_sliced(f, sliced_join);
+        return;
+      }
+    }
+
     const int rev_rank = m_pool_size - (m_pool_rank + 1);
 
     for (int i = 0; i < m_pool_fan_size; ++i) {
@@ -231,6 +240,30 @@ class ThreadsInternal {
     memory_fence();
   }
 
+  // Large array reduction: every thread joins a slice of all the values into
+  // the reduction memory of the root thread
+  template <class FunctorType>
+  inline void fan_in_reduce_sliced(const FunctorType &f,
+                                   const HostSlicedJoin &sliced_join) {
+    using value_type = typename FunctorType::value_type;
+
+    barrier();
+
+    sliced_join.template join<value_type>(m_pool_rank, m_pool_size, [&](int i) {
+      return reinterpret_cast<value_type *>(m_pool_base[i]->reduce_memory());
+    });
+
+    // Same completion as fan_in_reduce: the root waits for all the other
+    // threads to be done with their slice and to leave the parallel region.
+    fan_in();
+
+    if (m_pool_size == m_pool_rank + 1) {
+      f.final(reinterpret_cast<value_type *>(reduce_memory()));
+    }
+
+    memory_fence();
+  }
+
   inline void fan_in() const {
     const int rev_rank = m_pool_size - (m_pool_rank + 1);
 
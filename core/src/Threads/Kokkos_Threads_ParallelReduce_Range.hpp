@@ -18,10 +18,14 @@
 #define KOKKOS_THREADS_PARALLEL_REDUCE_RANGE_HPP
 
 #include <Kokkos_Parallel.hpp>
+#include <impl/Kokkos_HostReproducibleReduce.hpp>
 
 namespace Kokkos {
 namespace Impl {
 
+template <>
+struct SupportsReproducibleReduce<Kokkos::Threads> : std::true_type {};
+
 template <class CombinedFunctorReducerType, class... Traits>
 class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
                      Kokkos::Threads> {
@@ -72,6 +76,49 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
     exec_schedule<typename Policy::schedule_type::type>(instance, arg);
   }
 
+  using Reproducible = HostReproducibleReduce<Policy, ReducerType>;
+
+  struct ReproducibleArg {
+    const ParallelReduce *self;
+    const Reproducible *reproducible;
+  };
+
+  static void exec_reproducible(ThreadsInternal &instance, const void *arg) {
+    const ReproducibleArg &args = *static_cast<const ReproducibleArg *>(arg);
+
+    const ParallelReduce &self       = *args.self;
+    const Reproducible &reproducible = *args.reproducible;
+
+    const auto exec_block = [&](const int64_t block) {
+      reproducible.exec_block(
+          block, [&](const Member ibeg, const Member iend,
+                     reference_type update) {
+            ParallelReduce::template exec_range<WorkTag>(
+                self.m_functor_reducer.get_functor(), ibeg, iend, update);
+          });
+    };
+
+    if constexpr (std::is_same_v<typename Policy::schedule_type::type,
+                                 Kokkos::Dynamic>) {
+      instance.set_work_range(0, reproducible.num_blocks(), 1);
+      instance.reset_steal_target();
+      instance.barrier();
+
+      long work_index = instance.get_work_index();
+      while (work_index != -1) {
+        exec_block(work_index);
+        work_index = instance.get_work_index();
+      }
+    } else {
+      for (int64_t block = instance.pool_rank();
+           block < reproducible.num_blocks(); block += instance.pool_size()) {
+        exec_block(block);
+      }
+    }
+
+    instance.fan_in();
+  }
+
   template <class Schedule>
   static std::enable_if_t<std::is_same_v<Schedule, Kokkos::Static>>
   exec_schedule(ThreadsInternal &instance, const void *arg) {
@@ -131,6 +178,19 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
         reducer.init(m_result_ptr);
         reducer.final(m_result_ptr);
       }
+    } else if constexpr (Policy::is_reproducible::value) {
+      ThreadsInternal::resize_scratch(reducer.value_size(), 0);
+
+      const Reproducible reproducible(m_policy, reducer);
+      const ReproducibleArg arg{this, &reproducible};
+
+      ThreadsInternal::start(&ParallelReduce::exec_reproducible, &arg);
+
+      ThreadsInternal::fence();
+
+      reproducible.join(
+          m_result_ptr ? m_result_ptr
+                       : (pointer_type)ThreadsInternal::root_reduce_scratch());
     } else {
       ThreadsInternal::resize_scratch(reducer.value_size(), 0);
 
@@ -19,6 +19,7 @@
 
 #include <Kokkos_Core_fwd.hpp>
 #include <Threads/Kokkos_Threads_Instance.hpp>
+#include <impl/Kokkos_HostWorkGraphQueue.hpp>
 
 namespace Kokkos {
 namespace Impl {
@@ -34,6 +35,7 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
 
   Policy m_policy;
   FunctorType m_functor;
+  HostWorkGraphQueue<Policy>* m_queue = nullptr;
 
   template <class TagType>
   std::enable_if_t<std::is_void_v<TagType>> exec_one(
@@ -48,30 +50,27 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
     m_functor(t, w);
   }
 
-  inline void exec_one_thread() const noexcept {
-    // Spin until COMPLETED_TOKEN.
-    // END_TOKEN indicates no work is currently available.
-
-    for (std::int32_t w = Policy::END_TOKEN;
-         Policy::COMPLETED_TOKEN != (w = m_policy.pop_work());) {
-      if (Policy::END_TOKEN != w) {
-        exec_one<typename Policy::work_tag>(w);
-        m_policy.completed_work(w);
-      }
-    }
+  inline void exec_one_thread(const int rank) const noexcept {
+    m_queue->execute(rank, [this](const std::int32_t w) {
+      exec_one<typename Policy::work_tag>(w);
+    });
   }
 
   static inline void thread_main(ThreadsInternal& instance,
                                  const void* arg) noexcept {
     const Self& self = *(static_cast<const Self*>(arg));
-    self.exec_one_thread();
+    self.exec_one_thread(instance.pool_rank());
     instance.fan_in();
   }
 
  public:
   inline void execute() {
+    HostWorkGraphQueue<Policy> queue(m_policy,
+                                     Threads::impl_thread_pool_size());
+    m_queue = &queue;
     ThreadsInternal::start(&Self::thread_main, this);
     ThreadsInternal::fence();
+    m_queue = nullptr;
   }
 
   inline ParallelFor(const FunctorType& arg_functor, const Policy& arg_policy)
@@ -159,16 +159,36 @@ struct ViewValueFunctor {
     }
   }
 
+  // A memset from a single thread places every page of a host allocation
+  // on the NUMA domain of that thread.  Initializing with a parallel_for
+  // instead first touches the pages with the same static partition as a
+  // RangePolicy over the extent.  Only worth it if every thread gets at
+  // least a page.
+  bool use_parallel_first_touch() const {
+    if constexpr (std::is_same_v<typename DeviceType::memory_space,
+                                 Kokkos::HostSpace>) {
+      constexpr size_t page_size = 4096;
+      const size_t concurrency   = space.concurrency();
+      return 1 < concurrency &&
+             concurrency * page_size <= n * sizeof(ValueType);
+    } else {
+      return false;
+    }
+  }
+
   void construct_shared_allocation() {
 // On A64FX memset seems to do the wrong thing with regards to first touch
 // leading to the significant performance issues
 #ifndef KOKKOS_ARCH_A64FX
     if constexpr (std::is_trivial_v<ValueType>) {
       // value-initialization is equivalent to filling with zeros
-      zero_memset_implementation();
-    } else
+      if (!use_parallel_first_touch()) {
+        zero_memset_implementation();
+        return;
+      }
+    }
 #endif
-      parallel_for_implementation<ConstructTag>();
+    parallel_for_implementation<ConstructTag>();
   }
 
   void destroy_shared_allocation() {
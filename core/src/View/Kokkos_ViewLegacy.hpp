@@ -110,6 +110,9 @@ namespace Kokkos {
  * different \c Space types.  For example, with the Cuda device,
  * \c RandomAccess tells Kokkos to fetch the data through the texture
  * cache, whereas the non-GPU devices have no such hardware construct.
+ * Likewise, \c Streaming makes stores to the View non-temporal on
+ * host architectures that provide such instructions, and is a regular
+ * store elsewhere.
  *
  * \subsection Kokkos_View_MT_PrefUse Preferred use of MemoryTraits
  *
@@ -32,6 +32,7 @@
 #include <View/Kokkos_ViewTraits.hpp>
 #include <View/Kokkos_ViewCtor.hpp>
 #include <View/Kokkos_ViewAtomic.hpp>
+#include <View/Kokkos_ViewStreaming.hpp>
 #include <impl/Kokkos_Tools.hpp>
 #include <impl/Kokkos_StringManipulation.hpp>
 #include <impl/Kokkos_ZeroMemset_fwd.hpp>
@@ -2330,6 +2331,320 @@ struct ViewOffset<Dimension, Kokkos::LayoutStride, void> {
             stride(sub.range_index(6), rhs), stride(sub.range_index(7), rhs)) {}
 };
 
+//----------------------------------------------------------------------------
+// LayoutTiled : the entries are grouped into tiles of compile-time extents.
+// The offset of an entry is the index of its tile times the tile size plus
+// the index of the entry within the tile. Subviews keep the tile grid of the
+// viewed allocation and shift the indices by the origin of the subview.
+template <class Dimension, Kokkos::Experimental::TileOrder OuterP,
+          Kokkos::Iterate InnerP, unsigned ArgN0, unsigned ArgN1,
+          unsigned ArgN2>
+struct ViewOffset<Dimension,
+                  Kokkos::Experimental::LayoutTiled<OuterP, InnerP, ArgN0,
+                                                    ArgN1, ArgN2>,
+                  void> {
+  using is_mapping_plugin = std::true_type;
+  using is_regular        = std::false_type;
+
+  using size_type      = size_t;
+  using dimension_type = Dimension;
+  using array_layout =
+      Kokkos::Experimental::LayoutTiled<OuterP, InnerP, ArgN0, ArgN1, ArgN2>;
+
+  static_assert(dimension_type::rank == array_layout::rank,
+                "LayoutTiled requires a View of the same rank as its tiles");
+
+ private:
+  static constexpr unsigned rank = array_layout::rank;
+
+  static constexpr unsigned SHIFT_0 = integral_power_of_two(array_layout::N0);
+  static constexpr unsigned SHIFT_1 = integral_power_of_two(array_layout::N1);
+  static constexpr unsigned SHIFT_2 = integral_power_of_two(array_layout::N2);
+  static constexpr unsigned SHIFT_T = SHIFT_0 + SHIFT_1 + SHIFT_2;
+  static constexpr size_type MASK_0 = array_layout::N0 - 1;
+  static constexpr size_type MASK_1 = array_layout::N1 - 1;
+  static constexpr size_type MASK_2 = array_layout::N2 - 1;
+
+  static constexpr bool is_morton =
+      OuterP == Kokkos::Experimental::TileOrder::Morton;
+  // Largest Morton blocks, their interleaved indices fit into 32 bits
+  static constexpr unsigned max_morton_bits = rank == 2 ? 16 : 10;
+
+ public:
+  dimension_type m_dim;
+  // Number of tiles of the allocation in each dimension, or number of Morton
+  // blocks for TileOrder::Morton
+  size_type m_tiles[3];
+  // Indices of the first entry of the view within the allocation
+  size_type m_origin[3];
+  // Offset of the tile holding the first entry of the view
+  size_type m_base;
+  // Morton blocks are 2^m_morton_bits tiles wide in every dimension
+  unsigned m_morton_bits;
+
+ private:
+  KOKKOS_INLINE_FUNCTION static constexpr size_type spread_2(size_type x) {
+    x = (x | (x << 8)) & 0x00FF00FFu;
+    x = (x | (x << 4)) & 0x0F0F0F0Fu;
+    x = (x | (x << 2)) & 0x33333333u;
+    x = (x | (x << 1)) & 0x55555555u;
+    return x;
+  }
+
+  KOKKOS_INLINE_FUNCTION static constexpr size_type spread_3(size_type x) {
+    x = (x | (x << 16)) & 0x030000FFu;
+    x = (x | (x << 8)) & 0x0300F00Fu;
+    x = (x | (x << 4)) & 0x030C30C3u;
+    x = (x | (x << 2)) & 0x09249249u;
+    return x;
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr size_type tile_index(
+      const size_type t0, const size_type t1, const size_type t2) const {
+    if constexpr (OuterP == Kokkos::Experimental::TileOrder::Left) {
+      return t0 + m_tiles[0] * (t1 + m_tiles[1] * t2);
+    } else if constexpr (OuterP == Kokkos::Experimental::TileOrder::Right) {
+      return t2 + m_tiles[2] * (t1 + m_tiles[1] * t0);
+    } else {
+      const unsigned m     = m_morton_bits;
+      const size_type mask = (size_type(1) << m) - 1;
+      const size_type block =
+          (t2 >> m) + m_tiles[2] * ((t1 >> m) + m_tiles[1] * (t0 >> m));
+      if constexpr (rank == 2) {
+        return (block << (2 * m)) | (spread_2(t0 & mask) << 1) |
+               spread_2(t1 & mask);
+      } else {
+        return (block << (3 * m)) | (spread_3(t0 & mask) << 2) |
+               (spread_3(t1 & mask) << 1) | spread_3(t2 & mask);
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION static constexpr size_type entry_index(
+      const size_type j0, const size_type j1, const size_type j2) {
+    if constexpr (InnerP == Kokkos::Iterate::Left) {
+      return (j0 & MASK_0) | ((j1 & MASK_1) << SHIFT_0) |
+             ((j2 & MASK_2) << (SHIFT_0 + SHIFT_1));
+    } else {
+      return ((j0 & MASK_0) << (SHIFT_1 + SHIFT_2)) |
+             ((j1 & MASK_1) << SHIFT_2) | (j2 & MASK_2);
+    }
+  }
+
+  // Offset of an entry from the start of the allocation
+  KOKKOS_INLINE_FUNCTION constexpr size_type allocation_offset(
+      const size_type j0, const size_type j1, const size_type j2) const {
+    return (tile_index(j0 >> SHIFT_0, j1 >> SHIFT_1, j2 >> SHIFT_2)
+            << SHIFT_T) |
+           entry_index(j0, j1, j2);
+  }
+
+  // Tile and Morton block indices grow with each index, so the first and
+  // the last entry of the view lie in the first and the last of its tiles
+  KOKKOS_INLINE_FUNCTION constexpr size_type allocation_end() const {
+    return (tile_index((m_origin[0] + m_dim.N0 - 1) >> SHIFT_0,
+                       (m_origin[1] + m_dim.N1 - 1) >> SHIFT_1,
+                       (m_origin[2] + m_dim.N2 - 1) >> SHIFT_2) +
+            1)
+           << SHIFT_T;
+  }
+
+  KOKKOS_INLINE_FUNCTION void set_tiles(const size_type n0, const size_type n1,
+                                        const size_type n2) {
+    m_tiles[0] = (n0 + MASK_0) >> SHIFT_0;
+    m_tiles[1] = (n1 + MASK_1) >> SHIFT_1;
+    m_tiles[2] = (n2 + MASK_2) >> SHIFT_2;
+    m_morton_bits = 0;
+    if constexpr (is_morton) {
+      // Blocks are at most an eighth of the tile grid wide, which bounds the
+      // unused tiles at its edges
+      size_type min_tiles = m_tiles[0] < m_tiles[1] ? m_tiles[0] : m_tiles[1];
+      if (rank == 3 && m_tiles[2] < min_tiles) min_tiles = m_tiles[2];
+      while (m_morton_bits < max_morton_bits &&
+             (size_type(16) << m_morton_bits) <= min_tiles) {
+        ++m_morton_bits;
+      }
+      const size_type block_mask = (size_type(1) << m_morton_bits) - 1;
+      for (unsigned r = 0; r < rank; ++r) {
+        m_tiles[r] = (m_tiles[r] + block_mask) >> m_morton_bits;
+      }
+    }
+  }
+
+ public:
+  //----------------------------------------
+
+  // rank 2
+  template <typename I0, typename I1>
+  KOKKOS_INLINE_FUNCTION constexpr size_type operator()(I0 const& i0,
+                                                        I1 const& i1) const {
+    return allocation_offset(m_origin[0] + i0, m_origin[1] + i1, 0) - m_base;
+  }
+
+  // rank 3
+  template <typename I0, typename I1, typename I2>
+  KOKKOS_INLINE_FUNCTION constexpr size_type operator()(I0 const& i0,
+                                                        I1 const& i1,
+                                                        I2 const& i2) const {
+    return allocation_offset(m_origin[0] + i0, m_origin[1] + i1,
+                             m_origin[2] + i2) -
+           m_base;
+  }
+
+  //----------------------------------------
+
+  KOKKOS_INLINE_FUNCTION
+  constexpr array_layout layout() const {
+    return array_layout(m_dim.N0, m_dim.N1,
+                        (rank > 2 ? m_dim.N2 : KOKKOS_INVALID_INDEX));
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_0() const {
+    return m_dim.N0;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_1() const {
+    return m_dim.N1;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_2() const {
+    return m_dim.N2;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_3() const {
+    return m_dim.N3;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_4() const {
+    return m_dim.N4;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_5() const {
+    return m_dim.N5;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_6() const {
+    return m_dim.N6;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_7() const {
+    return m_dim.N7;
+  }
+
+  /* Cardinality of the domain index space */
+  KOKKOS_INLINE_FUNCTION
+  constexpr size_type size() const {
+    return size_type(m_dim.N0) * m_dim.N1 * m_dim.N2;
+  }
+
+  /* Span of the range space, including the unused entries of partial tiles */
+  KOKKOS_INLINE_FUNCTION
+  constexpr size_type span() const {
+    return size() == 0 ? 0 : allocation_end() - m_base;
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr bool span_is_contiguous() const {
+    return span() == size();
+  }
+
+  /* Strides between neighboring entries within a tile */
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_0() const {
+    return InnerP == Kokkos::Iterate::Left ? 1
+                                           : size_type(1)
+                                                 << (SHIFT_1 + SHIFT_2);
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_1() const {
+    return InnerP == Kokkos::Iterate::Left ? size_type(1) << SHIFT_0
+                                           : size_type(1) << SHIFT_2;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_2() const {
+    return InnerP == Kokkos::Iterate::Left
+               ? size_type(1) << (SHIFT_0 + SHIFT_1)
+               : 1;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_3() const {
+    return size_type(1) << SHIFT_T;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_4() const {
+    return size_type(1) << SHIFT_T;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_5() const {
+    return size_type(1) << SHIFT_T;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_6() const {
+    return size_type(1) << SHIFT_T;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_7() const {
+    return size_type(1) << SHIFT_T;
+  }
+
+  // Fill the target unbounded array s with the stride.
+  // This method differs from stride() in that it does not write the total
+  // length to the last index of the array. Preconditions: s must be an array of
+  // dimension_type::rank elements
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION iType stride_fill(iType* const s) const {
+    s[0] = stride_0();
+    s[1] = stride_1();
+    if constexpr (2 < rank) {
+      s[2] = stride_2();
+    }
+    return span();
+  }
+
+  // Fill the target unbounded array s with the stride and the total spanned
+  // size. This method differs from stride_fill() in that it writes the total
+  // spanned size to the last index of the array. Preconditions: s must be an
+  // array of dimension_type::rank + 1 elements
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION void stride(iType* const s) const {
+    s[dimension_type::rank] = stride_fill(s);
+  }
+
+  //----------------------------------------
+
+  ViewOffset()                             = default;
+  ViewOffset(const ViewOffset&)            = default;
+  ViewOffset& operator=(const ViewOffset&) = default;
+
+  template <unsigned TrivialScalarSize>
+  KOKKOS_INLINE_FUNCTION ViewOffset(
+      std::integral_constant<unsigned, TrivialScalarSize> const&,
+      array_layout const& arg_layout)
+      : m_dim(arg_layout.dimension[0], arg_layout.dimension[1],
+              arg_layout.dimension[2], 0, 0, 0, 0, 0),
+        m_tiles{},
+        m_origin{0, 0, 0},
+        m_base(0),
+        m_morton_bits(0) {
+    set_tiles(m_dim.N0, m_dim.N1, m_dim.N2);
+  }
+
+  template <class DimRHS>
+  KOKKOS_INLINE_FUNCTION constexpr ViewOffset(
+      const ViewOffset<DimRHS, array_layout, void>& rhs)
+      : m_dim(rhs.m_dim.N0, rhs.m_dim.N1, rhs.m_dim.N2, 0, 0, 0, 0, 0),
+        m_tiles{rhs.m_tiles[0], rhs.m_tiles[1], rhs.m_tiles[2]},
+        m_origin{rhs.m_origin[0], rhs.m_origin[1], rhs.m_origin[2]},
+        m_base(rhs.m_base),
+        m_morton_bits(rhs.m_morton_bits) {
+    static_assert(int(DimRHS::rank) == int(dimension_type::rank),
+                  "ViewOffset assignment requires equal rank");
+  }
+
+  //----------------------------------------
+  // Subview construction
+
+  template <class DimRHS>
+  KOKKOS_INLINE_FUNCTION ViewOffset(
+      const ViewOffset<DimRHS, array_layout, void>& rhs,
+      const SubviewExtents<DimRHS::rank, dimension_type::rank>& sub)
+      : m_dim(sub.range_extent(0), sub.range_extent(1), sub.range_extent(2),
+              0, 0, 0, 0, 0),
+        m_tiles{rhs.m_tiles[0], rhs.m_tiles[1], rhs.m_tiles[2]},
+        m_origin{rhs.m_origin[0] + sub.domain_offset(0),
+                 rhs.m_origin[1] + sub.domain_offset(1),
+                 rhs.m_origin[2] + sub.domain_offset(2)},
+        m_base(0),
+        m_morton_bits(rhs.m_morton_bits) {
+    m_base = allocation_offset(m_origin[0] & ~MASK_0, m_origin[1] & ~MASK_1,
+                               m_origin[2] & ~MASK_2);
+  }
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -2396,12 +2711,43 @@ struct ViewDataHandle<
   }
 };
 
+// Streaming stores only apply to writable, non-atomic views.  They take
+// precedence over the Restrict and Aligned traits.
+template <class Traits>
+inline constexpr bool view_data_handle_is_streaming_v =
+    std::is_same_v<typename Traits::non_const_value_type,
+                   typename Traits::value_type> &&
+    std::is_void_v<typename Traits::specialize> &&
+    Traits::memory_traits::is_streaming && !Traits::memory_traits::is_atomic;
+
+template <class Traits>
+struct ViewDataHandle<
+    Traits, std::enable_if_t<view_data_handle_is_streaming_v<Traits>>> {
+  using value_type  = typename Traits::value_type;
+  using handle_type = typename Kokkos::Impl::StreamingViewDataHandle<Traits>;
+  using return_type = typename Kokkos::Impl::StreamingDataElement<Traits>;
+  using track_type  = Kokkos::Impl::SharedAllocationTracker;
+
+  KOKKOS_INLINE_FUNCTION
+  static handle_type assign(value_type* arg_data_ptr,
+                            track_type const& /*arg_tracker*/) {
+    return handle_type(arg_data_ptr);
+  }
+
+  template <class SrcHandleType>
+  KOKKOS_INLINE_FUNCTION static handle_type assign(
+      const SrcHandleType& arg_handle, size_t offset) {
+    return handle_type(arg_handle + offset);
+  }
+};
+
 template <class Traits>
 struct ViewDataHandle<
     Traits, std::enable_if_t<(std::is_void_v<typename Traits::specialize> &&
                               (!Traits::memory_traits::is_aligned) &&
                               Traits::memory_traits::is_restrict &&
-                              (!Traits::memory_traits::is_atomic))>> {
+                              (!Traits::memory_traits::is_atomic) &&
+                              (!view_data_handle_is_streaming_v<Traits>))>> {
   using value_type  = typename Traits::value_type;
   using handle_type = typename Traits::value_type* KOKKOS_RESTRICT;
   using return_type = typename Traits::value_type& KOKKOS_RESTRICT;
@@ -2424,7 +2770,8 @@ struct ViewDataHandle<
     Traits, std::enable_if_t<(std::is_void_v<typename Traits::specialize> &&
                               Traits::memory_traits::is_aligned &&
                               (!Traits::memory_traits::is_restrict) &&
-                              (!Traits::memory_traits::is_atomic))>> {
+                              (!Traits::memory_traits::is_atomic) &&
+                              (!view_data_handle_is_streaming_v<Traits>))>> {
   using value_type = typename Traits::value_type;
   // typedef work-around for intel compilers error #3186: expected typedef
   // declaration
@@ -2462,7 +2809,8 @@ struct ViewDataHandle<
     Traits, std::enable_if_t<(std::is_void_v<typename Traits::specialize> &&
                               Traits::memory_traits::is_aligned &&
                               Traits::memory_traits::is_restrict &&
-                              (!Traits::memory_traits::is_atomic))>> {
+                              (!Traits::memory_traits::is_atomic) &&
+                              (!view_data_handle_is_streaming_v<Traits>))>> {
   using value_type = typename Traits::value_type;
   // typedef work-around for intel compilers error #3186: expected typedef
   // declaration
@@ -3333,6 +3681,85 @@ class ViewMapping<
   }
 };
 
+//----------------------------------------------------------------------------
+// Subviews of a LayoutTiled View keep its layout and its tile grid, so they
+// can only restrict the ranges of the indices.
+
+template <class SrcTraits, class... Args>
+class ViewMapping<
+    std::enable_if_t<(std::is_void_v<typename SrcTraits::specialize> &&
+                      is_layout_tiled_v<typename SrcTraits::array_layout>)>,
+    SrcTraits, Args...> {
+ private:
+  static_assert(SrcTraits::rank == sizeof...(Args),
+                "Subview mapping requires one argument for each dimension of "
+                "source View");
+
+  enum {
+    rank = unsigned(is_integral_extent<0, Args...>::value) +
+           unsigned(is_integral_extent<1, Args...>::value) +
+           unsigned(is_integral_extent<2, Args...>::value)
+  };
+
+  static_assert(rank == SrcTraits::rank,
+                "Subview of a View with LayoutTiled requires ranges for all "
+                "its dimensions");
+
+  using array_layout = typename SrcTraits::array_layout;
+
+  using value_type = typename SrcTraits::value_type;
+
+  using data_type =
+      typename SubViewDataType<value_type,
+                               typename Kokkos::Impl::ParseViewExtents<
+                                   typename SrcTraits::data_type>::type,
+                               Args...>::type;
+
+ public:
+  using traits_type = Kokkos::ViewTraits<data_type, array_layout,
+                                         typename SrcTraits::device_type,
+                                         typename SrcTraits::memory_traits>;
+
+  using type =
+      Kokkos::View<data_type, array_layout, typename SrcTraits::device_type,
+                   typename SrcTraits::memory_traits>;
+
+  template <class MemoryTraits>
+  struct apply {
+    static_assert(Kokkos::is_memory_traits<MemoryTraits>::value);
+
+    using traits_type =
+        Kokkos::ViewTraits<data_type, array_layout,
+                           typename SrcTraits::device_type, MemoryTraits>;
+
+    using type = Kokkos::View<data_type, array_layout,
+                              typename SrcTraits::device_type, MemoryTraits>;
+  };
+
+  template <class DstTraits>
+  KOKKOS_INLINE_FUNCTION static void assign(
+      ViewMapping<DstTraits, void>& dst,
+      ViewMapping<SrcTraits, void> const& src, Args... args) {
+    static_assert(ViewMapping<DstTraits, traits_type, void>::is_assignable,
+                  "Subview destination type must be compatible with subview "
+                  "derived type");
+
+    using DstType = ViewMapping<DstTraits, void>;
+
+    using dst_offset_type = typename DstType::offset_type;
+
+    const SubviewExtents<SrcTraits::rank, rank> extents(src.m_impl_offset.m_dim,
+                                                        args...);
+
+    dst.m_impl_offset = dst_offset_type(src.m_impl_offset, extents);
+
+    // The handle points to the first tile of the subview
+    dst.m_impl_handle = ViewDataHandle<DstTraits>::assign(
+        src.m_impl_handle,
+        dst.m_impl_offset.m_base - src.m_impl_offset.m_base);
+  }
+};
+
 //----------------------------------------------------------------------------
 
 }  // namespace Impl
@@ -0,0 +1,146 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_VIEWSTREAMING_HPP
+#define KOKKOS_VIEWSTREAMING_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <cstring>
+#include <type_traits>
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_nontemporal_store)
+#define KOKKOS_IMPL_HAS_BUILTIN_NONTEMPORAL_STORE
+#endif
+#endif
+
+#if !defined(KOKKOS_IMPL_HAS_BUILTIN_NONTEMPORAL_STORE) && defined(__SSE2__)
+#include <emmintrin.h>
+#define KOKKOS_IMPL_HAS_SSE2_NONTEMPORAL_STORE
+#endif
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  Store a value bypassing the cache hierarchy where the host
+ *          architecture supports it.
+ *
+ *  Non-temporal stores go through write-combining buffers and are weakly
+ *  ordered with respect to other stores.  The host backends release all
+ *  the stores of a kernel when it completes (the closing barrier of the
+ *  thread pool or the release of the instance lock), so the values are
+ *  visible to any later kernel or fence.  Types without a suitable
+ *  instruction and device code use a regular store.
+ */
+template <class T>
+KOKKOS_FORCEINLINE_FUNCTION void host_nontemporal_store(T* ptr,
+                                                        const T& val) {
+#if defined(KOKKOS_IMPL_HAS_BUILTIN_NONTEMPORAL_STORE)
+  if constexpr (std::is_arithmetic_v<T>) {
+    __builtin_nontemporal_store(val, ptr);
+  } else {
+    *ptr = val;
+  }
+#elif defined(KOKKOS_IMPL_HAS_SSE2_NONTEMPORAL_STORE)
+  if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) == sizeof(int)) {
+    int bits;
+    std::memcpy(&bits, &val, sizeof(int));
+    _mm_stream_si32(reinterpret_cast<int*>(ptr), bits);
+  }
+#if defined(__x86_64__)
+  else if constexpr (std::is_trivially_copyable_v<T> &&
+                     sizeof(T) == sizeof(long long)) {
+    long long bits;
+    std::memcpy(&bits, &val, sizeof(long long));
+    _mm_stream_si64(reinterpret_cast<long long*>(ptr), bits);
+  }
+#endif
+  else {
+    *ptr = val;
+  }
+#else
+  *ptr = val;
+#endif
+}
+
+template <class T>
+KOKKOS_FORCEINLINE_FUNCTION void nontemporal_store(T* ptr, const T& val) {
+  KOKKOS_IF_ON_HOST((host_nontemporal_store(ptr, val);))
+  KOKKOS_IF_ON_DEVICE((*ptr = val;))
+}
+
+// The following tag is used to prevent an implicit call of the constructor
+// when trying to assign a literal 0 int ( = 0 );
+struct StreamingViewConstTag {};
+
+/** \brief  Reference type of a View with the Streaming memory trait.
+ *
+ *  Assignments are non-temporal stores, reads are regular loads.
+ */
+template <class ViewTraits>
+class StreamingDataElement {
+ public:
+  using value_type           = typename ViewTraits::value_type;
+  using const_value_type     = typename ViewTraits::const_value_type;
+  using non_const_value_type = typename ViewTraits::non_const_value_type;
+  value_type* const ptr;
+
+  KOKKOS_INLINE_FUNCTION
+  StreamingDataElement(value_type* ptr_, StreamingViewConstTag) : ptr(ptr_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  const_value_type operator=(const_value_type& val) const {
+    nontemporal_store(ptr, non_const_value_type(val));
+    return val;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  const_value_type operator=(const StreamingDataElement& rhs) const {
+    const non_const_value_type val = *rhs.ptr;
+    nontemporal_store(ptr, val);
+    return val;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  operator value_type() const { return *ptr; }
+};
+
+template <class ViewTraits>
+class StreamingViewDataHandle {
+ public:
+  typename ViewTraits::value_type* ptr;
+
+  KOKKOS_INLINE_FUNCTION
+  StreamingViewDataHandle() : ptr(nullptr) {}
+
+  KOKKOS_INLINE_FUNCTION
+  StreamingViewDataHandle(typename ViewTraits::value_type* ptr_) : ptr(ptr_) {}
+
+  template <class iType>
+  KOKKOS_INLINE_FUNCTION StreamingDataElement<ViewTraits> operator[](
+      const iType& i) const {
+    return StreamingDataElement<ViewTraits>(ptr + i, StreamingViewConstTag());
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  operator typename ViewTraits::value_type *() const { return ptr; }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -22,12 +22,14 @@
 #include <traits/Kokkos_Traits_fwd.hpp>
 #include <traits/Kokkos_PolicyTraitAdaptor.hpp>
 
+#include <traits/Kokkos_ElementwiseTrait.hpp>
 #include <traits/Kokkos_ExecutionSpaceTrait.hpp>
 #include <traits/Kokkos_GraphKernelTrait.hpp>
 #include <traits/Kokkos_IndexTypeTrait.hpp>
 #include <traits/Kokkos_IterationPatternTrait.hpp>
 #include <traits/Kokkos_LaunchBoundsTrait.hpp>
 #include <traits/Kokkos_OccupancyControlTrait.hpp>
+#include <traits/Kokkos_ReproducibleTrait.hpp>
 #include <traits/Kokkos_ScheduleTrait.hpp>
 #include <traits/Kokkos_WorkItemPropertyTrait.hpp>
 #include <traits/Kokkos_WorkTagTrait.hpp>
@@ -93,6 +93,8 @@ void combine(Kokkos::InitializationSettings& out,
   KOKKOS_IMPL_COMBINE_SETTING(disable_warnings);
   KOKKOS_IMPL_COMBINE_SETTING(print_configuration);
   KOKKOS_IMPL_COMBINE_SETTING(tune_internals);
+  KOKKOS_IMPL_COMBINE_SETTING(tuning_cache);
+  KOKKOS_IMPL_COMBINE_SETTING(kernel_statistics);
   KOKKOS_IMPL_COMBINE_SETTING(tools_help);
   KOKKOS_IMPL_COMBINE_SETTING(tools_libs);
   KOKKOS_IMPL_COMBINE_SETTING(tools_args);
@@ -774,6 +776,11 @@ void post_initialize_internal(const Kokkos::InitializationSettings& settings) {
   Kokkos::Tools::InitArguments tools_init_arguments;
   combine(tools_init_arguments, settings);
   initialize_profiling(tools_init_arguments);
+  if (settings.has_kernel_statistics() && settings.get_kernel_statistics()) {
+    Kokkos::Tools::Impl::initialize_kernel_statistics();
+  }
+  Kokkos::Tools::Experimental::Impl::initialize_default_tuner(
+      settings.has_tuning_cache() ? settings.get_tuning_cache() : "");
   g_is_initialized = true;
   if (settings.has_print_configuration() &&
       settings.get_print_configuration()) {
@@ -805,6 +812,7 @@ void call_registered_finalize_hook_functions() noexcept {
 
 void pre_finalize_internal() {
   call_registered_finalize_hook_functions();
+  Kokkos::Tools::Experimental::Impl::finalize_default_tuner();
   Kokkos::Profiling::finalize();
 }
 
@@ -833,7 +841,15 @@ Kokkos Core Options:
   --kokkos-print-configuration   : print configuration
   --kokkos-tune-internals        : allow Kokkos to autotune policies and declare
                                    tuning features through the tuning system. If
-                                   left off, Kokkos uses heuristics
+                                   left off, Kokkos uses heuristics. Without a
+                                   tool implementing the tuning callbacks, the
+                                   built-in default tuner is used
+  --kokkos-tuning-cache=STR      : file in which the default tuner stores its
+                                   choices at finalize, and from which they
+                                   are reloaded at initialization
+  --kokkos-kernel-statistics     : time the kernels and deep copies and track
+                                   the memory allocated in each space without a
+                                   tool library, print a summary at finalize
   --kokkos-num-threads=INT       : specify total number of threads to use for
                                    parallel regions on the host.
   --kokkos-device-id=INT         : specify device id to be used by Kokkos.
@@ -888,6 +904,8 @@ void Kokkos::Impl::parse_command_line_arguments(
   bool disable_warnings;
   bool print_configuration;
   bool tune_internals;
+  std::string tuning_cache;
+  bool kernel_statistics;
 
   bool help_flag = false;
 
@@ -927,6 +945,14 @@ void Kokkos::Impl::parse_command_line_arguments(
                               tune_internals)) {
       settings.set_tune_internals(tune_internals);
       remove_flag = true;
+    } else if (check_arg_str(argv[iarg], "--kokkos-tuning-cache",
+                             tuning_cache)) {
+      settings.set_tuning_cache(tuning_cache);
+      remove_flag = true;
+    } else if (check_arg_bool(argv[iarg], "--kokkos-kernel-statistics",
+                              kernel_statistics)) {
+      settings.set_kernel_statistics(kernel_statistics);
+      remove_flag = true;
     } else if (check_arg(argv[iarg], "--kokkos-help") ||
                check_arg(argv[iarg], "--help")) {
       help_flag   = true;
@@ -1019,6 +1045,14 @@ void Kokkos::Impl::parse_environment_variables(
   if (check_env_bool("KOKKOS_TUNE_INTERNALS", tune_internals)) {
     settings.set_tune_internals(tune_internals);
   }
+  char const* tuning_cache = std::getenv("KOKKOS_TUNING_CACHE");
+  if (tuning_cache != nullptr) {
+    settings.set_tuning_cache(tuning_cache);
+  }
+  bool kernel_statistics;
+  if (check_env_bool("KOKKOS_KERNEL_STATISTICS", kernel_statistics)) {
+    settings.set_kernel_statistics(kernel_statistics);
+  }
   char const* map_device_id_by = std::getenv("KOKKOS_MAP_DEVICE_ID_BY");
   if (map_device_id_by != nullptr) {
     if (std::getenv("KOKKOS_DEVICE_ID")) {
@@ -1102,7 +1136,10 @@ void Kokkos::finalize() {
 #ifdef KOKKOS_COMPILER_INTEL
 void Kokkos::fence() { fence("Kokkos::fence: Unnamed Global Fence"); }
 #endif
-void Kokkos::fence(const std::string& name) { fence_internal(name); }
+void Kokkos::fence(const std::string& name) {
+  Kokkos::Impl::graph_capture_fence_all();
+  fence_internal(name);
+}
 
 namespace {
 void print_helper(std::ostream& os,
@@ -0,0 +1,341 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Tuners.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*--------------------------------------------------------------------------*/
+/* The default tuner treats every (kernel label, policy shape) pair as a
+ * multi-armed bandit whose arms are the candidate configurations provided by
+ * the policy tuners in Kokkos_Tuners.hpp. The first launch of a problem is a
+ * warm-up that is not measured, then every candidate is tried once and
+ * subsequent launches are chosen with UCB1, using the speedup relative to the
+ * fastest candidate as reward. After a fixed budget of launches the fastest
+ * candidate is kept for good and kernels are no longer timed.
+ *
+ * Each launch carries its own candidate and start time from
+ * begin_default_tuning to end_default_tuning, so that concurrent launches of
+ * the same kernel are measured separately. Threads cache the problems they
+ * have looked up, and the launches of a converged problem take no lock.
+ *
+ * Converged choices can be written to a cache file at finalize and are reused
+ * without any exploration by runs loading that file at initialization.
+ */
+/*--------------------------------------------------------------------------*/
+
+namespace Kokkos {
+namespace Tools {
+namespace Experimental {
+namespace Impl {
+
+namespace {
+
+struct DefaultTuningProblem {
+  std::vector<std::vector<int64_t>> candidates;
+  std::vector<size_t> trials;
+  std::vector<double> total_time;
+  size_t total_trials = 0;
+  // the candidate kept once converged, only changed before that
+  size_t current = 0;
+  bool warm      = false;
+  std::atomic<bool> converged{false};
+
+  // launches spent exploring before the fastest candidate is kept
+  size_t budget() const { return 4 * candidates.size() + 16; }
+
+  double mean_time(size_t candidate) const {
+    return total_time[candidate] / trials[candidate];
+  }
+
+  size_t fastest() const {
+    size_t best = 0;
+    for (size_t i = 1; i < candidates.size(); ++i) {
+      if (trials[i] > 0 &&
+          (trials[best] == 0 || mean_time(i) < mean_time(best))) {
+        best = i;
+      }
+    }
+    return best;
+  }
+
+  size_t select() const {
+    if (converged || !warm) return current;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      if (trials[i] == 0) return i;
+    }
+    const double fastest_time = mean_time(fastest());
+    const double log_trials   = std::log(static_cast<double>(total_trials));
+    size_t choice             = 0;
+    double best_score         = 0.0;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      const double speedup = fastest_time / mean_time(i);
+      const double score   = speedup + std::sqrt(2.0 * log_trials / trials[i]);
+      if (score > best_score) {
+        best_score = score;
+        choice     = i;
+      }
+    }
+    return choice;
+  }
+
+  void record(size_t candidate, double time) {
+    if (!warm) {
+      warm = true;
+      return;
+    }
+    ++trials[candidate];
+    total_time[candidate] += time;
+    if (++total_trials >= budget()) {
+      current = fastest();
+      converged.store(true, std::memory_order_release);
+    }
+  }
+};
+
+struct DefaultTuner {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<DefaultTuningProblem>> problems;
+  std::unordered_map<std::string, size_t> problem_ids;
+  std::unordered_map<std::string, std::vector<int64_t>> cache;
+  std::string cache_file;
+  // bumped when the problems are cleared, to drop the caches of the threads
+  std::atomic<size_t> generation{1};
+};
+
+DefaultTuner& default_tuner() {
+  static DefaultTuner tuner;
+  return tuner;
+}
+
+// The problems a thread has already looked up
+struct ThreadProblems {
+  size_t generation = 0;
+  std::unordered_map<std::string, size_t> ids;
+  std::vector<DefaultTuningProblem*> problems;
+};
+
+ThreadProblems& thread_problems(DefaultTuner& tuner) {
+  thread_local ThreadProblems cached;
+  const size_t generation = tuner.generation.load(std::memory_order_acquire);
+  if (cached.generation != generation) {
+    cached.ids.clear();
+    cached.problems.clear();
+    cached.generation = generation;
+  }
+  return cached;
+}
+
+// Must not be called with the lock of the tuner held
+DefaultTuningProblem* find_problem(DefaultTuner& tuner, size_t problem) {
+  auto& cached = thread_problems(tuner);
+  if (problem < cached.problems.size() && cached.problems[problem]) {
+    return cached.problems[problem];
+  }
+  std::lock_guard<std::mutex> lock(tuner.mutex);
+  if (problem >= tuner.problems.size()) return nullptr;
+  if (cached.problems.size() <= problem) {
+    cached.problems.resize(problem + 1, nullptr);
+  }
+  return cached.problems[problem] = tuner.problems[problem].get();
+}
+
+// Each line of the cache file holds the number of values of a configuration,
+// the values and the key of the tuning problem, separated by spaces
+void read_cache(const std::string& file_name,
+                std::unordered_map<std::string, std::vector<int64_t>>& cache) {
+  std::ifstream file(file_name);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream entry(line);
+    size_t count = 0;
+    std::vector<int64_t> configuration;
+    if (!(entry >> count)) continue;
+    configuration.resize(count);
+    for (auto& value : configuration) entry >> value;
+    std::string key;
+    entry.get();
+    std::getline(entry, key);
+    if (entry.fail() || key.empty()) continue;
+    cache[key] = std::move(configuration);
+  }
+}
+
+void write_cache(
+    const std::string& file_name,
+    const std::unordered_map<std::string, std::vector<int64_t>>& cache) {
+  std::ofstream file(file_name);
+  if (!file) {
+    if (Kokkos::show_warnings()) {
+      std::cerr << "Warning: could not write the Kokkos tuning cache '"
+                << file_name << "'. Raised by Kokkos::finalize()."
+                << std::endl;
+    }
+    return;
+  }
+  file << "# Kokkos default tuner cache\n";
+  for (const auto& [key, configuration] : cache) {
+    if (key.find('\n') != std::string::npos) continue;
+    file << configuration.size();
+    for (auto value : configuration) file << ' ' << value;
+    file << ' ' << key << '\n';
+  }
+}
+
+}  // namespace
+
+void initialize_default_tuner(const std::string& cache_file) {
+  auto& tuner = default_tuner();
+  std::lock_guard<std::mutex> lock(tuner.mutex);
+  tuner.cache_file = cache_file;
+  if (!cache_file.empty()) read_cache(cache_file, tuner.cache);
+}
+
+void finalize_default_tuner() {
+  auto& tuner = default_tuner();
+  std::lock_guard<std::mutex> lock(tuner.mutex);
+  if (!tuner.cache_file.empty()) {
+    for (const auto& [key, id] : tuner.problem_ids) {
+      const auto& problem = *tuner.problems[id];
+      if (problem.converged) {
+        tuner.cache[key] = problem.candidates[problem.current];
+      }
+    }
+    write_cache(tuner.cache_file, tuner.cache);
+  }
+  tuner.problems.clear();
+  tuner.problem_ids.clear();
+  tuner.cache.clear();
+  tuner.cache_file.clear();
+  tuner.generation.fetch_add(1, std::memory_order_release);
+}
+
+size_t get_default_tuning_problem(const std::string& key) {
+  auto& tuner   = default_tuner();
+  auto& cached  = thread_problems(tuner);
+  auto is_known = cached.ids.find(key);
+  if (is_known != cached.ids.end()) return is_known->second;
+  std::lock_guard<std::mutex> lock(tuner.mutex);
+  auto found = tuner.problem_ids.find(key);
+  if (found == tuner.problem_ids.end()) return invalid_default_tuning_problem;
+  cached.ids.emplace(key, found->second);
+  return found->second;
+}
+
+size_t declare_default_tuning_problem(
+    const std::string& key, std::vector<std::vector<int64_t>> candidates) {
+  auto& tuner = default_tuner();
+  std::lock_guard<std::mutex> lock(tuner.mutex);
+  auto found = tuner.problem_ids.find(key);
+  if (found != tuner.problem_ids.end()) return found->second;
+
+  auto problem        = std::make_unique<DefaultTuningProblem>();
+  problem->candidates = std::move(candidates);
+  problem->trials.assign(problem->candidates.size(), 0);
+  problem->total_time.assign(problem->candidates.size(), 0.0);
+  // nothing to choose from, keep the policy as is
+  if (problem->candidates.size() <= 1) problem->converged = true;
+  // a configuration from a previous run, if it is still a valid candidate
+  auto cached = tuner.cache.find(key);
+  if (cached != tuner.cache.end()) {
+    for (size_t i = 0; i < problem->candidates.size(); ++i) {
+      if (problem->candidates[i] == cached->second) {
+        problem->current   = i;
+        problem->converged = true;
+      }
+    }
+  }
+  tuner.problems.push_back(std::move(problem));
+  tuner.problem_ids.emplace(key, tuner.problems.size() - 1);
+  return tuner.problems.size() - 1;
+}
+
+DefaultTuningToken begin_default_tuning(size_t problem_id,
+                                        std::vector<int64_t>& configuration) {
+  DefaultTuningToken token;
+  auto& tuner   = default_tuner();
+  auto* problem = find_problem(tuner, problem_id);
+  if (problem == nullptr || problem->candidates.empty()) {
+    configuration.clear();
+    return token;
+  }
+  if (problem->converged.load(std::memory_order_acquire)) {
+    configuration = problem->candidates[problem->current];
+    return token;
+  }
+  std::lock_guard<std::mutex> lock(tuner.mutex);
+  token.problem   = problem_id;
+  token.candidate = problem->select();
+  token.measuring = !problem->converged.load(std::memory_order_relaxed);
+  configuration   = problem->candidates[token.candidate];
+  token.start     = std::chrono::steady_clock::now();
+  return token;
+}
+
+bool default_tuning_is_measuring(size_t problem_id) {
+  auto* problem = find_problem(default_tuner(), problem_id);
+  return problem != nullptr &&
+         !problem->converged.load(std::memory_order_acquire);
+}
+
+void end_default_tuning(const DefaultTuningToken& token) {
+  if (!token.measuring) return;
+  const double time = std::chrono::duration<double>(
+                          std::chrono::steady_clock::now() - token.start)
+                          .count();
+  auto& tuner   = default_tuner();
+  auto* problem = find_problem(tuner, token.problem);
+  if (problem == nullptr) return;
+  std::lock_guard<std::mutex> lock(tuner.mutex);
+  if (!problem->converged.load(std::memory_order_relaxed)) {
+    problem->record(token.candidate, time);
+  }
+}
+
+DefaultTuningLaunch& default_tuning_launch(const void* tuner) {
+  thread_local std::unordered_map<const void*, DefaultTuningLaunch> launches;
+  return launches[tuner];
+}
+
+}  // namespace Impl
+
+bool have_default_tuner() {
+#ifdef KOKKOS_ENABLE_TUNING
+  return Kokkos::tune_internals() && !have_tuning_tool();
+#else
+  return false;
+#endif
+}
+
+}  // namespace Experimental
+}  // namespace Tools
+}  // namespace Kokkos
@@ -24,6 +24,9 @@
 #include <Kokkos_Graph.hpp>
 #include <Kokkos_Parallel.hpp>
 #include <Kokkos_Parallel_Reduce.hpp>
+#include <impl/Kokkos_GraphCapture.hpp>
+
+#include <memory>
 
 namespace Kokkos {
 namespace Impl {
@@ -37,21 +40,66 @@ struct GraphNodeKernelDefaultImpl {
   //      function pointers like in the rest of the graph interface
   virtual void execute_kernel() = 0;
 
+  // Run the iterations [begin, end) of an elementwise kernel on the calling
+  // thread, see m_is_elementwise
+  virtual void execute_iterations(int64_t /*begin*/, int64_t /*end*/) const {}
+
   GraphNodeKernelDefaultImpl() = default;
 
   explicit GraphNodeKernelDefaultImpl(ExecutionSpace exec)
       : m_execution_space(std::move(exec)) {}
 
   ExecutionSpace m_execution_space;
+
+  // RangePolicy parallel_for kernels with the Experimental::Elementwise trait
+  // can be fused with adjacent ones over the same range
+  bool m_is_elementwise = false;
+  int64_t m_begin       = 0;
+  int64_t m_end         = 0;
+};
+
+// Keeps a copy of the functor of the kernels that can be fused, which run
+// their iterations outside of their parallel pattern implementation, and
+// records their range in the type-erased kernel
+template <class Functor, bool IsElementwise>
+struct GraphNodeElementwiseFunctor {
+  template <class KernelBase, class Policy>
+  GraphNodeElementwiseFunctor(KernelBase &, Functor const &, Policy const &) {}
+};
+
+template <class Functor>
+struct GraphNodeElementwiseFunctor<Functor, true> {
+  template <class KernelBase, class Policy>
+  GraphNodeElementwiseFunctor(KernelBase &kernel, Functor const &arg_functor,
+                              Policy const &arg_policy)
+      : m_elementwise_functor(arg_functor) {
+    kernel.m_is_elementwise = true;
+    kernel.m_begin          = arg_policy.begin();
+    kernel.m_end            = arg_policy.end();
+  }
+  Functor m_elementwise_functor;
 };
 
 // TODO Indicate that this kernel specialization is only for the Host somehow?
+template <class PolicyType, class PatternTag>
+inline constexpr bool is_graph_elementwise_kernel_v =
+    std::is_same_v<PatternTag, ParallelForTag> &&
+    is_graph_elementwise_range_policy_v<PolicyType>;
+
 template <class ExecutionSpace, class PolicyType, class Functor,
           class PatternTag, class... Args>
 class GraphNodeKernelImpl
     : public GraphNodeKernelDefaultImpl<ExecutionSpace>,
+      // initialized before the pattern implementation takes the functor
+      public GraphNodeElementwiseFunctor<
+          Functor, is_graph_elementwise_kernel_v<PolicyType, PatternTag>>,
       public PatternImplSpecializationFromTag<PatternTag, Functor, PolicyType,
                                               Args..., ExecutionSpace>::type {
+  static constexpr bool is_elementwise =
+      is_graph_elementwise_kernel_v<PolicyType, PatternTag>;
+  using elementwise_functor_base_t =
+      GraphNodeElementwiseFunctor<Functor, is_elementwise>;
+
  public:
   using base_t =
       typename PatternImplSpecializationFromTag<PatternTag, Functor, PolicyType,
@@ -69,6 +117,9 @@ class GraphNodeKernelImpl
                       Functor arg_functor, PolicyDeduced &&arg_policy,
                       ArgsDeduced &&...args)
       : execute_kernel_vtable_base_t(arg_policy.space()),
+        elementwise_functor_base_t(
+            static_cast<execute_kernel_vtable_base_t &>(*this), arg_functor,
+            arg_policy),
         base_t(std::move(arg_functor), (PolicyDeduced &&)arg_policy,
                (ArgsDeduced &&)args...) {}
 
@@ -83,6 +134,20 @@ class GraphNodeKernelImpl
   }
 
   void execute_kernel() final { this->base_t::execute(); }
+
+  void execute_iterations(int64_t begin, int64_t end) const final {
+    if constexpr (is_elementwise) {
+      using member_type = typename Policy::member_type;
+      using work_tag    = typename Policy::work_tag;
+      for (int64_t i = begin; i < end; ++i) {
+        if constexpr (std::is_void_v<work_tag>) {
+          this->m_elementwise_functor(member_type(i));
+        } else {
+          this->m_elementwise_functor(work_tag{}, member_type(i));
+        }
+      }
+    }
+  }
 };
 
 // </editor-fold> end GraphNodeKernelImpl }}}1
@@ -100,6 +165,34 @@ struct GraphNodeAggregateKernelDefaultImpl
   void execute_kernel() final {}
 };
 
+// Kernel of a node recorded by capturing an execution space instance, see
+// Kokkos::Experimental::begin_capture
+template <class ExecutionSpace>
+struct GraphNodeCapturedKernelDefaultImpl
+    : GraphNodeKernelDefaultImpl<ExecutionSpace> {
+  struct Policy {
+    using is_graph_kernel = std::true_type;
+  };
+  using graph_kernel = GraphNodeCapturedKernelDefaultImpl;
+
+  GraphNodeCapturedKernelDefaultImpl(
+      ExecutionSpace exec, std::shared_ptr<GraphCapturedOperation> operation)
+      : GraphNodeKernelDefaultImpl<ExecutionSpace>(std::move(exec)),
+        m_operation(std::move(operation)) {
+    this->m_is_elementwise = m_operation->m_is_elementwise;
+    this->m_begin          = m_operation->m_begin;
+    this->m_end            = m_operation->m_end;
+  }
+
+  void execute_kernel() final { m_operation->execute(); }
+
+  void execute_iterations(int64_t begin, int64_t end) const final {
+    m_operation->execute_iterations(begin, end);
+  }
+
+  std::shared_ptr<GraphCapturedOperation> m_operation;
+};
+
 }  // end namespace Impl
 }  // end namespace Kokkos
 
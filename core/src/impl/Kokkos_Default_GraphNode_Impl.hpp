@@ -23,12 +23,36 @@
 
 #include <Kokkos_Graph.hpp>
 
+#include <Kokkos_ExecPolicy.hpp>
+#include <Kokkos_Parallel.hpp>
+
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 #include <memory>
 
 namespace Kokkos {
 namespace Impl {
 
+// Runs blocks of iterations of a chain of fused elementwise kernels, each
+// block through all the kernels in turn while its data is still in cache
+template <class ExecutionSpace>
+struct GraphFusedKernels {
+  GraphNodeKernelDefaultImpl<ExecutionSpace>* const* kernels;
+  int num_kernels;
+  int64_t begin;
+  int64_t end;
+  int64_t block_size;
+
+  void operator()(int64_t block) const {
+    const int64_t block_begin = begin + block * block_size;
+    const int64_t block_end   = std::min(block_begin + block_size, end);
+    for (int k = 0; k < num_kernels; ++k) {
+      kernels[k]->execute_iterations(block_begin, block_end);
+    }
+  }
+};
+
 //==============================================================================
 // <editor-fold desc="GraphNodeBackendSpecificDetails"> {{{1
 
@@ -46,13 +70,12 @@ struct GraphNodeBackendSpecificDetails {
 
   Kokkos::ObservingRawPtr<default_kernel_impl_t> m_kernel_ptr = nullptr;
 
-  bool m_has_executed = false;
+  // The kernel of this node followed by the kernels fused with it, if any
+  std::vector<default_kernel_impl_t*> m_fused_kernels = {};
+
   bool m_is_aggregate = false;
   bool m_is_root      = false;
 
-  template <class>
-  friend struct HostGraphImpl;
-
  protected:
   //----------------------------------------------------------------------------
   // <editor-fold desc="Ctors, destructor, and assignment"> {{{2
@@ -61,7 +84,7 @@ struct GraphNodeBackendSpecificDetails {
 
   explicit GraphNodeBackendSpecificDetails(
       _graph_node_is_root_ctor_tag) noexcept
-      : m_has_executed(true), m_is_root(true) {}
+      : m_is_root(true) {}
 
   GraphNodeBackendSpecificDetails(GraphNodeBackendSpecificDetails const&) =
       delete;
@@ -107,51 +130,59 @@ struct GraphNodeBackendSpecificDetails {
   void set_predecessor(
       std::shared_ptr<GraphNodeBackendSpecificDetails<ExecutionSpace>>
           arg_pred_impl) {
-    // This method delegates responsibility for executing the predecessor to
-    // this node.  Each node can have at most one predecessor (which may be an
-    // aggregate).
+    // Each node can have at most one predecessor (which may be an aggregate).
     KOKKOS_EXPECTS(m_predecessors.empty() || m_is_aggregate)
     KOKKOS_EXPECTS(bool(arg_pred_impl))
-    KOKKOS_EXPECTS(!m_has_executed)
     m_predecessors.push_back(std::move(arg_pred_impl));
   }
 
-  void execute_node(const ExecutionSpace& exec) {
-    // This node could have already been executed as the predecessor of some
-    // other
-    KOKKOS_EXPECTS(bool(m_kernel_ptr) || m_has_executed)
-    // Just execute the predecessor here, since calling set_predecessor()
-    // delegates the responsibility for running it to us.
-    if (!m_has_executed) {
-      // I'm pretty sure this doesn't need to be atomic under our current
-      // supported semantics, but instinct I have feels like it should be...
-      m_has_executed = true;
-      for (auto const& predecessor : m_predecessors) {
-        predecessor->execute_node(exec);
-      }
-
-      // Before executing the kernel, be sure to fence the execution space
-      // instance of predecessors.
-      for (const auto& predecessor : m_predecessors) {
-        if (predecessor->awaitable() &&
-            predecessor->get_execution_space() != this->get_execution_space())
-          predecessor->get_execution_space().fence(
-              "Kokkos::DefaultGraphNode::execute_node: sync with predecessors");
-      }
+  std::vector<std::shared_ptr<GraphNodeBackendSpecificDetails<ExecutionSpace>>>
+      const& get_predecessors() const {
+    return m_predecessors;
+  }
 
-      m_kernel_ptr->execute_kernel();
-    }
-    KOKKOS_ENSURES(m_has_executed)
+  // Whether the kernel of this node can be fused with the kernel of the
+  // given node following it
+  bool can_fuse_with(GraphNodeBackendSpecificDetails const& next) const {
+    return m_kernel_ptr->m_is_elementwise &&
+           next.m_kernel_ptr->m_is_elementwise &&
+           m_kernel_ptr->m_begin == next.m_kernel_ptr->m_begin &&
+           m_kernel_ptr->m_end == next.m_kernel_ptr->m_end &&
+           get_execution_space() == next.get_execution_space();
   }
 
-  // This is gross, but for the purposes of our simple default implementation...
-  void reset_has_executed() {
-    for (auto const& predecessor : m_predecessors) {
-      predecessor->reset_has_executed();
+  // Run the kernel of the given node as part of the kernel of this node
+  void fuse(GraphNodeBackendSpecificDetails const& next) {
+    KOKKOS_EXPECTS(can_fuse_with(next))
+    if (m_fused_kernels.empty()) m_fused_kernels.push_back(m_kernel_ptr);
+    m_fused_kernels.push_back(next.m_kernel_ptr);
+  }
+
+  // Launch the kernel of this node on its execution space instance. The
+  // graph is responsible for launching the predecessors first.
+  void execute_kernel() {
+    KOKKOS_EXPECTS(awaitable())
+    if (m_fused_kernels.empty()) {
+      m_kernel_ptr->execute_kernel();
+      return;
     }
-    // more readable, probably:
-    //   if(!m_is_root) m_has_executed = false;
-    m_has_executed = m_is_root;
+    // Blocks of a few thousand iterations keep the data touched by the chain
+    // in cache, while leaving enough blocks to keep the pool busy
+    const int64_t begin       = m_kernel_ptr->m_begin;
+    const int64_t end         = m_kernel_ptr->m_end;
+    const int64_t length      = end - begin;
+    const int64_t concurrency = get_execution_space().concurrency();
+    const int64_t block_size  = std::max<int64_t>(
+        1, std::min<int64_t>(2048, (length + concurrency - 1) / concurrency));
+    using functor_t = GraphFusedKernels<ExecutionSpace>;
+    using policy_t  =
+        Kokkos::RangePolicy<ExecutionSpace, Kokkos::IndexType<int64_t>>;
+    Impl::ParallelFor<functor_t, policy_t> closure(
+        functor_t{m_fused_kernels.data(), int(m_fused_kernels.size()), begin,
+                  end, block_size},
+        policy_t(get_execution_space(), 0,
+                 (length + block_size - 1) / block_size));
+    closure.execute();
   }
 };
 
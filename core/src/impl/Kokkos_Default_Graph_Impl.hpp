@@ -25,16 +25,73 @@
 
 #include <Serial/Kokkos_Serial.hpp>
 #include <OpenMP/Kokkos_OpenMP.hpp>
+#ifdef KOKKOS_ENABLE_OPENMP
+#include <OpenMP/Kokkos_OpenMP_Instance.hpp>
+#endif
 // FIXME @graph other backends?
 
 #include <impl/Kokkos_OptionalRef.hpp>
 #include <impl/Kokkos_EBO.hpp>
 
+#include <algorithm>
+#include <map>
 #include <set>
+#include <vector>
 
 namespace Kokkos {
 namespace Impl {
 
+//==============================================================================
+// <editor-fold desc="GraphLevelLauncher"> {{{1
+
+// Launches the kernels of one level of a graph. The kernels of a level are
+// independent of each other and come in groups sharing an execution space
+// instance, each group in launch order. By default the groups are launched one
+// after the other from the calling thread.
+template <class ExecutionSpace>
+struct GraphLevelLauncher {
+  template <class Groups>
+  static void launch(Groups const& groups) {
+    for (auto const& group : groups) {
+      for (auto* node : group) node->execute_kernel();
+    }
+  }
+};
+
+#ifdef KOKKOS_ENABLE_OPENMP
+// Instances created with OpenMP(pool_size) own distinct thread pools. With
+// nested parallelism each group is driven by one thread of an enclosing
+// parallel region, from which its kernels fork the pool of their instance, so
+// that independent branches of the graph overlap.
+template <>
+struct GraphLevelLauncher<Kokkos::OpenMP> {
+  template <class Groups>
+  static void launch(Groups const& groups) {
+    const int num_groups = groups.size();
+    if (num_groups < 2 || omp_get_level() != 0 ||
+        !is_nested_parallelism_enabled()) {
+      GraphLevelLauncher<void>::launch(groups);
+      return;
+    }
+    // Kernels launched from a parallel region execute right away, so they
+    // must not overtake kernels still queued on their instance
+    for (auto const& group : groups) {
+      group.front()
+          ->get_execution_space()
+          .impl_internal_space_instance()
+          ->wait_for_dispatched();
+    }
+#pragma omp parallel for schedule(static, 1) num_threads(num_groups)
+    for (int i = 0; i < num_groups; ++i) {
+      for (auto* node : groups[i]) node->execute_kernel();
+    }
+  }
+};
+#endif
+
+// </editor-fold> end GraphLevelLauncher }}}1
+//==============================================================================
+
 //==============================================================================
 // <editor-fold desc="GraphImpl default implementation"> {{{1
 
@@ -63,7 +120,15 @@ struct GraphImpl : private ExecutionSpaceInstanceStorage<ExecutionSpace> {
   GraphImpl(GraphImpl&&)                 = delete;
   GraphImpl& operator=(GraphImpl const&) = delete;
   GraphImpl& operator=(GraphImpl&&)      = delete;
-  ~GraphImpl()                           = default;
+
+  // The launches of fused chains refer to the kernels of the graph, so they
+  // may not outlive it when the instances dispatch asynchronously
+  ~GraphImpl() {
+    for (auto const& instance : m_fused_instances) {
+      instance.fence(
+          "Kokkos::DefaultGraph::~GraphImpl: wait for fused kernel chains");
+    }
+  }
 
   explicit GraphImpl(ExecutionSpace arg_space)
       : execution_space_instance_storage_base_t(std::move(arg_space)) {}
@@ -96,8 +161,13 @@ struct GraphImpl : private ExecutionSpaceInstanceStorage<ExecutionSpace> {
   // already been added to this graph and NodeImpl is a specialization of
   // GraphNodeImpl that has already been added to this graph.
   void add_predecessor(NodeImplPtr arg_node_ptr, PredecessorRef arg_pred_ref) {
+    add_predecessor_ptr(std::move(arg_node_ptr),
+                        GraphAccess::get_node_ptr(arg_pred_ref));
+  }
+
+  void add_predecessor_ptr(std::shared_ptr<node_details_t> const& arg_node_ptr,
+                           std::shared_ptr<node_details_t> pred_ptr) {
     auto node_ptr_spot = m_sinks.find(arg_node_ptr);
-    auto pred_ptr      = GraphAccess::get_node_ptr(arg_pred_ref);
     auto pred_ref_spot = m_sinks.find(pred_ptr);
     KOKKOS_ASSERT(node_ptr_spot != m_sinks.end())
     if (pred_ref_spot != m_sinks.end()) {
@@ -136,18 +206,100 @@ struct GraphImpl : private ExecutionSpaceInstanceStorage<ExecutionSpace> {
     return rv;
   }
 
+  // Adds the operations recorded by capturing execution space instances, each
+  // after the operations it was recorded after
+  void add_captured_operations(GraphCapture const& capture) {
+    using captured_kernel_impl_t =
+        GraphNodeCapturedKernelDefaultImpl<ExecutionSpace>;
+    using captured_node_impl_t =
+        GraphNodeImpl<ExecutionSpace, captured_kernel_impl_t,
+                      Kokkos::Experimental::TypeErasedTag>;
+    std::shared_ptr<node_details_t> root = create_root_node_ptr();
+    std::vector<std::shared_ptr<node_details_t>> nodes;
+    for (auto const& record : capture.records()) {
+      auto const& exec = *std::static_pointer_cast<ExecutionSpace>(
+          capture.instance(record.instance));
+      auto node = GraphAccess::make_node_shared_ptr<captured_node_impl_t>(
+          exec, _graph_node_kernel_ctor_tag{},
+          captured_kernel_impl_t{exec, record.operation});
+      add_node(node);
+      // a node has a single predecessor, an aggregate if it needs several
+      std::shared_ptr<node_details_t> pred = root;
+      if (record.predecessors.size() == 1) {
+        pred = nodes[record.predecessors.front()];
+      } else if (record.predecessors.size() > 1) {
+        auto aggregate = create_aggregate_ptr();
+        add_node(aggregate);
+        for (auto i : record.predecessors) {
+          add_predecessor_ptr(aggregate, nodes[i]);
+        }
+        pred = aggregate;
+      }
+      add_predecessor_ptr(node, std::move(pred));
+      nodes.push_back(std::move(node));
+    }
+  }
+
   void instantiate() {
     KOKKOS_EXPECTS(!m_has_been_instantiated);
     m_has_been_instantiated = true;
+
+    // Each kernel goes one level after the latest of its predecessors
+    std::map<node_details_t*, int> levels;
+    std::vector<node_details_t*> kernels;
+    for (auto const& sink : m_sinks) {
+      for (auto* kernel : kernel_nodes(*sink)) {
+        compute_level(kernel, levels, kernels);
+        add_instance(m_sink_instances, kernel->get_execution_space());
+      }
+    }
+
+    // A chain of elementwise kernels, each the only successor of the previous
+    // one, runs as a single kernel launched by the first one of the chain
+    std::map<node_details_t*, std::vector<node_details_t*>> successors;
+    for (auto* kernel : kernels) {
+      for (auto* pred : kernel_predecessors(*kernel))
+        successors[pred].push_back(kernel);
+    }
+    std::set<node_details_t*> fused;
+    for (auto* kernel : kernels) {
+      if (fused.count(kernel)) continue;
+      for (auto* last = kernel; successors[last].size() == 1;) {
+        auto* next = successors[last].front();
+        auto const& next_preds = next->get_predecessors();
+        if (next_preds.size() != 1 || next_preds.front().get() != last ||
+            !last->can_fuse_with(*next))
+          break;
+        kernel->fuse(*next);
+        fused.insert(next);
+        add_instance(m_fused_instances, kernel->get_execution_space());
+        last = next;
+      }
+    }
+
+    for (auto* kernel : kernels) {
+      if (fused.count(kernel)) continue;
+      auto const& exec = kernel->get_execution_space();
+      const int level  = levels[kernel];
+      if (int(m_levels.size()) <= level) m_levels.resize(level + 1);
+      auto& groups = m_levels[level].groups;
+      auto spot    = groups.begin();
+      while (spot != groups.end() &&
+             spot->front()->get_execution_space() != exec)
+        ++spot;
+      if (spot == groups.end()) spot = groups.emplace(groups.end());
+      spot->push_back(kernel);
+      // Kernels launched on the same instance execute in order, only the
+      // instances of other predecessors need to be waited for
+      for (auto* pred : kernel_predecessors(*kernel)) {
+        if (pred->get_execution_space() != exec)
+          add_instance(m_levels[level].fences, pred->get_execution_space());
+      }
+    }
   }
 
   void submit(const ExecutionSpace& exec) {
     if (!m_has_been_instantiated) instantiate();
-    // This reset is gross, but for the purposes of our simple host
-    // implementation...
-    for (auto& sink : m_sinks) {
-      sink->reset_has_executed();
-    }
 
     // We don't know where the nodes will execute, so we need to fence the given
     // execution space instance before proceeding. This is the simplest way
@@ -155,14 +307,17 @@ struct GraphImpl : private ExecutionSpaceInstanceStorage<ExecutionSpace> {
     exec.fence(
         "Kokkos::DefaultGraph::submit: fencing before launching graph nodes");
 
-    for (auto& sink : m_sinks) {
-      sink->execute_node(exec);
+    for (auto const& level : m_levels) {
+      for (auto const& instance : level.fences) {
+        instance.fence("Kokkos::DefaultGraph::submit: sync with predecessors");
+      }
+      GraphLevelLauncher<ExecutionSpace>::launch(level.groups);
     }
 
     // Once all sinks have been executed, we need to fence them.
-    for (const auto& sink : m_sinks) {
-      if (sink->awaitable() && sink->get_execution_space() != exec)
-        sink->get_execution_space().fence(
+    for (auto const& instance : m_sink_instances) {
+      if (instance != exec)
+        instance.fence(
             "Kokkos::DefaultGraph::submit: fencing before ending graph submit");
     }
   }
@@ -170,6 +325,57 @@ struct GraphImpl : private ExecutionSpaceInstanceStorage<ExecutionSpace> {
  private:
   bool m_has_been_instantiated = false;
 
+  struct level_t {
+    // instances to wait for before launching the level
+    std::vector<ExecutionSpace> fences;
+    std::vector<std::vector<node_details_t*>> groups;
+  };
+  std::vector<level_t> m_levels;
+  std::vector<ExecutionSpace> m_sink_instances;
+  // instances running chains of fused kernels
+  std::vector<ExecutionSpace> m_fused_instances;
+
+  static void add_instance(std::vector<ExecutionSpace>& instances,
+                           ExecutionSpace const& instance) {
+    if (std::find(instances.begin(), instances.end(), instance) ==
+        instances.end())
+      instances.push_back(instance);
+  }
+
+  // The nodes launching a kernel among the given node and, for a root or an
+  // aggregate node, the nodes it depends on
+  static std::vector<node_details_t*> kernel_nodes(node_details_t& node) {
+    if (node.awaitable()) return {&node};
+    return kernel_predecessors(node);
+  }
+
+  static std::vector<node_details_t*> kernel_predecessors(
+      node_details_t const& node) {
+    std::vector<node_details_t*> preds;
+    for (auto const& pred : node.get_predecessors()) {
+      for (auto* kernel : kernel_nodes(*pred)) {
+        if (std::find(preds.begin(), preds.end(), kernel) == preds.end())
+          preds.push_back(kernel);
+      }
+    }
+    return preds;
+  }
+
+  // Appends the kernels to the given list after their predecessors
+  static int compute_level(node_details_t* kernel,
+                           std::map<node_details_t*, int>& levels,
+                           std::vector<node_details_t*>& kernels) {
+    auto spot = levels.find(kernel);
+    if (spot != levels.end()) return spot->second;
+    int level = 0;
+    for (auto* pred : kernel_predecessors(*kernel)) {
+      level = std::max(level, compute_level(pred, levels, kernels) + 1);
+    }
+    levels.emplace(kernel, level);
+    kernels.push_back(kernel);
+    return level;
+  }
+
   // </editor-fold> end required customizations }}}2
   //----------------------------------------------------------------------------
 };
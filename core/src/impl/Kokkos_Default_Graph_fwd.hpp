@@ -28,6 +28,9 @@ struct GraphNodeKernelDefaultImpl;
 template <class ExecutionSpace>
 struct GraphNodeAggregateKernelDefaultImpl;
 
+template <class ExecutionSpace>
+struct GraphNodeCapturedKernelDefaultImpl;
+
 }  // end namespace Impl
 }  // end namespace Kokkos
 
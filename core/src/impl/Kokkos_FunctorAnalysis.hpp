@@ -931,6 +931,11 @@ struct FunctorAnalysis {
     static constexpr bool has_final_member_function() {
       return DeduceFinal<>::value;
     }
+    // Array values joined by the default element-wise sum, so that disjoint
+    // slices of the values can be joined independently
+    static constexpr bool has_elementwise_join() {
+      return candidate_is_array && !DeduceJoin<>::value;
+    }
 
     KOKKOS_FUNCTION unsigned int value_size() const {
       return FunctorAnalysis::value_size(m_functor);
@@ -0,0 +1,173 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <impl/Kokkos_GraphCapture.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+namespace Kokkos {
+namespace Impl {
+
+namespace {
+
+struct CapturedInstance {
+  GraphCaptureKey key;
+  std::shared_ptr<GraphCapture> capture;
+  int instance;
+};
+
+// Checked before every launch, so that nothing else is done while no
+// instance is captured
+std::atomic<int> num_captured_instances{0};
+
+std::mutex& captured_instances_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::vector<CapturedInstance>& captured_instances() {
+  static std::vector<CapturedInstance> instances;
+  return instances;
+}
+
+}  // namespace
+
+int GraphCapture::add_instance(std::shared_ptr<void> instance,
+                               int forked_from) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_instances.push_back(std::move(instance));
+  m_last.push_back(-1);
+  m_pending.emplace_back();
+  if (forked_from >= 0 && m_last[forked_from] >= 0) {
+    m_pending.back().push_back(m_last[forked_from]);
+  }
+  return int(m_instances.size()) - 1;
+}
+
+void GraphCapture::record(int instance,
+                          std::shared_ptr<GraphCapturedOperation> operation) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::vector<std::size_t> predecessors = std::move(m_pending[instance]);
+  m_pending[instance].clear();
+  if (m_last[instance] >= 0) predecessors.push_back(m_last[instance]);
+  std::sort(predecessors.begin(), predecessors.end());
+  predecessors.erase(std::unique(predecessors.begin(), predecessors.end()),
+                     predecessors.end());
+  m_last[instance] = m_records.size();
+  m_records.push_back({std::move(operation), instance, predecessors});
+}
+
+void GraphCapture::fence(int instance) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_last[instance] < 0) return;
+  for (int i = 0; i < int(m_instances.size()); ++i) {
+    if (i != instance) m_pending[i].push_back(m_last[instance]);
+  }
+}
+
+void GraphCapture::fence_all() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (int fenced = 0; fenced < int(m_instances.size()); ++fenced) {
+    if (m_last[fenced] < 0) continue;
+    for (int i = 0; i < int(m_instances.size()); ++i) {
+      if (i != fenced) m_pending[i].push_back(m_last[fenced]);
+    }
+  }
+}
+
+bool graph_capture_is_active() noexcept {
+  return num_captured_instances.load(std::memory_order_relaxed) > 0;
+}
+
+void graph_capture_begin(GraphCaptureKey key,
+                         std::shared_ptr<GraphCapture> capture, int instance) {
+  std::lock_guard<std::mutex> lock(captured_instances_mutex());
+  auto& instances = captured_instances();
+  for (auto const& captured : instances) {
+    if (captured.key == key) {
+      throw_runtime_exception(
+          "Kokkos::Experimental::begin_capture: the execution space instance "
+          "is already being captured");
+    }
+  }
+  instances.push_back({key, std::move(capture), instance});
+  num_captured_instances.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::shared_ptr<GraphCapture> graph_capture_end(GraphCaptureKey key) {
+  std::lock_guard<std::mutex> lock(captured_instances_mutex());
+  auto& instances = captured_instances();
+  auto spot       = std::find_if(
+      instances.begin(), instances.end(),
+      [&](CapturedInstance const& captured) { return captured.key == key; });
+  if (spot == instances.end() || spot->instance != 0) {
+    throw_runtime_exception(
+        "Kokkos::Experimental::end_capture: the execution space instance did "
+        "not begin a capture");
+  }
+  auto capture = spot->capture;
+  auto last    = std::remove_if(
+      instances.begin(), instances.end(),
+      [&](CapturedInstance const& captured) {
+        return captured.capture == capture;
+      });
+  num_captured_instances.fetch_sub(instances.end() - last,
+                                   std::memory_order_relaxed);
+  instances.erase(last, instances.end());
+  return capture;
+}
+
+std::shared_ptr<GraphCapture> graph_capture_find(GraphCaptureKey key,
+                                                 int& instance) {
+  std::lock_guard<std::mutex> lock(captured_instances_mutex());
+  for (auto const& captured : captured_instances()) {
+    if (captured.key == key) {
+      instance = captured.instance;
+      return captured.capture;
+    }
+  }
+  return nullptr;
+}
+
+void graph_capture_fence(GraphCaptureKey key) {
+  int instance = 0;
+  if (auto capture = graph_capture_find(key, instance)) {
+    capture->fence(instance);
+  }
+}
+
+void graph_capture_fence_all() {
+  if (!graph_capture_is_active()) return;
+  std::vector<std::shared_ptr<GraphCapture>> captures;
+  {
+    std::lock_guard<std::mutex> lock(captured_instances_mutex());
+    for (auto const& captured : captured_instances()) {
+      if (std::find(captures.begin(), captures.end(), captured.capture) ==
+          captures.end())
+        captures.push_back(captured.capture);
+    }
+  }
+  for (auto const& capture : captures) capture->fence_all();
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
@@ -0,0 +1,284 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_GRAPH_CAPTURE_HPP
+#define KOKKOS_IMPL_GRAPH_CAPTURE_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_DetectionIdiom.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Kokkos {
+
+template <class... Properties>
+class RangePolicy;
+
+namespace Impl {
+
+//==============================================================================
+// <editor-fold desc="captured operations"> {{{1
+
+// While an execution space instance is captured into a graph, see
+// Kokkos::Experimental::begin_capture, the kernels and deep copies issued on
+// it are recorded as operations of the graph instead of being executed. Only
+// the host backends, which share the default graph implementation, can be
+// captured.
+template <class ExecutionSpace>
+inline constexpr bool is_graph_capturable_v =
+    std::is_same_v<typename ExecutionSpace::memory_space, Kokkos::HostSpace>;
+
+template <class PolicyType>
+struct is_graph_range_policy : std::false_type {};
+
+template <class... Properties>
+struct is_graph_range_policy<Kokkos::RangePolicy<Properties...>>
+    : std::true_type {};
+
+template <class PolicyType>
+inline constexpr bool is_graph_elementwise_range_policy_v = [] {
+  if constexpr (is_graph_range_policy<PolicyType>::value) {
+    return PolicyType::is_elementwise::value;
+  } else {
+    return false;
+  }
+}();
+
+struct GraphCapturedOperation {
+  virtual ~GraphCapturedOperation() = default;
+
+  virtual void execute() = 0;
+
+  // Run the iterations [begin, end) of an elementwise kernel on the calling
+  // thread, so that it can be fused like the kernels added to a graph
+  virtual void execute_iterations(int64_t /*begin*/, int64_t /*end*/) const {}
+
+  bool m_is_elementwise = false;
+  int64_t m_begin       = 0;
+  int64_t m_end         = 0;
+};
+
+// A kernel keeps its closure, which references the Views of the functor for as
+// long as the graph exists
+template <class Closure>
+struct GraphCapturedKernel : GraphCapturedOperation {
+  template <class... Args>
+  explicit GraphCapturedKernel(Args const&... args) : m_closure(args...) {}
+
+  void execute() override { m_closure.execute(); }
+
+  Closure m_closure;
+};
+
+template <class Functor, class Policy>
+struct GraphCapturedParallelFor final
+    : GraphCapturedKernel<ParallelFor<Functor, Policy>> {
+  static constexpr bool is_elementwise =
+      is_graph_elementwise_range_policy_v<Policy>;
+
+  GraphCapturedParallelFor(Functor const& functor, Policy const& policy)
+      : GraphCapturedKernel<ParallelFor<Functor, Policy>>(functor, policy),
+        m_functor(functor) {
+    if constexpr (is_elementwise) {
+      this->m_is_elementwise = true;
+      this->m_begin          = policy.begin();
+      this->m_end            = policy.end();
+    }
+  }
+
+  void execute_iterations(int64_t begin, int64_t end) const override {
+    if constexpr (is_elementwise) {
+      using member_type = typename Policy::member_type;
+      using work_tag    = typename Policy::work_tag;
+      for (int64_t i = begin; i < end; ++i) {
+        if constexpr (std::is_void_v<work_tag>) {
+          m_functor(member_type(i));
+        } else {
+          m_functor(work_tag{}, member_type(i));
+        }
+      }
+    }
+  }
+
+  Functor m_functor;
+};
+
+// Any other operation, e.g. a deep copy, is a call issuing it again
+template <class Callable>
+struct GraphCapturedCall final : GraphCapturedOperation {
+  explicit GraphCapturedCall(Callable const& callable) : m_callable(callable) {}
+
+  void execute() override { m_callable(); }
+
+  Callable m_callable;
+};
+
+// </editor-fold> end captured operations }}}1
+//==============================================================================
+
+//==============================================================================
+// <editor-fold desc="GraphCapture"> {{{1
+
+// Identifies an execution space instance independently of its type
+struct GraphCaptureKey {
+  void const* type;
+  std::uintptr_t instance;
+
+  friend bool operator==(GraphCaptureKey const& lhs,
+                         GraphCaptureKey const& rhs) {
+    return lhs.type == rhs.type && lhs.instance == rhs.instance;
+  }
+};
+
+template <class ExecutionSpace>
+inline constexpr char graph_capture_type_tag = 0;
+
+template <class ExecutionSpace>
+using graph_capture_internal_instance_t =
+    decltype(std::declval<ExecutionSpace const&>()
+                 .impl_internal_space_instance());
+
+template <class ExecutionSpace>
+GraphCaptureKey graph_capture_key(ExecutionSpace const& exec) {
+  if constexpr (is_detected_v<graph_capture_internal_instance_t,
+                              ExecutionSpace>) {
+    return {&graph_capture_type_tag<ExecutionSpace>,
+            reinterpret_cast<std::uintptr_t>(
+                exec.impl_internal_space_instance())};
+  } else {
+    return {&graph_capture_type_tag<ExecutionSpace>,
+            std::uintptr_t(exec.impl_instance_id())};
+  }
+}
+
+/** \brief The operations recorded by capturing one or several execution space
+ *         instances into the same graph.
+ *
+ *  The instances are numbered in the order they joined the capture, the one
+ *  that began it first.  An operation comes after the previous one recorded on
+ *  its instance.  A fence of an instance orders the later operations of all
+ *  the instances after the ones recorded so far on the fenced one, just like
+ *  the calling thread can rely on their results after the fence.
+ */
+class GraphCapture {
+ public:
+  struct record_t {
+    std::shared_ptr<GraphCapturedOperation> operation;
+    int instance;
+    // indices of the records the operation comes after
+    std::vector<std::size_t> predecessors;
+  };
+
+  explicit GraphCapture(std::shared_ptr<void> origin) {
+    add_instance(std::move(origin), -1);
+  }
+
+  // The execution space instance is type-erased, the graph casts it back
+  std::shared_ptr<void> const& instance(int i) const { return m_instances[i]; }
+  std::vector<record_t> const& records() const { return m_records; }
+
+  // Returns the number of the new instance, whose operations come after the
+  // ones recorded so far on the instance it was forked from, if any
+  int add_instance(std::shared_ptr<void> instance, int forked_from);
+
+  void record(int instance, std::shared_ptr<GraphCapturedOperation> operation);
+
+  void fence(int instance);
+
+  void fence_all();
+
+ private:
+  std::mutex m_mutex;
+  std::vector<std::shared_ptr<void>> m_instances;
+  std::vector<record_t> m_records;
+  // per instance, the last record on it (or -1) and the records of other
+  // instances its next operation must come after
+  std::vector<std::ptrdiff_t> m_last;
+  std::vector<std::vector<std::size_t>> m_pending;
+};
+
+bool graph_capture_is_active() noexcept;
+
+// Registers the capture of an instance, with the number it has in the capture
+void graph_capture_begin(GraphCaptureKey key,
+                         std::shared_ptr<GraphCapture> capture, int instance);
+
+// Removes all the instances of the capture begun on the given instance
+std::shared_ptr<GraphCapture> graph_capture_end(GraphCaptureKey key);
+
+// The capture of the given instance, if any, and its number in the capture
+std::shared_ptr<GraphCapture> graph_capture_find(GraphCaptureKey key,
+                                                 int& instance);
+
+void graph_capture_fence(GraphCaptureKey key);
+
+void graph_capture_fence_all();
+
+template <class ExecutionSpace>
+bool graph_capture_is_capturing(ExecutionSpace const& exec) {
+  if constexpr (is_graph_capturable_v<ExecutionSpace>) {
+    int instance = 0;
+    return graph_capture_is_active() &&
+           bool(graph_capture_find(graph_capture_key(exec), instance));
+  } else {
+    return false;
+  }
+}
+
+// Records the operation constructed from the arguments if the instance is
+// being captured, returns whether it was recorded
+template <class Operation, class ExecutionSpace, class... Args>
+bool graph_capture_record(ExecutionSpace const& exec, Args const&... args) {
+  if constexpr (is_graph_capturable_v<ExecutionSpace>) {
+    if (graph_capture_is_active()) {
+      int instance = 0;
+      auto capture = graph_capture_find(graph_capture_key(exec), instance);
+      if (capture) {
+        capture->record(instance, std::make_shared<Operation>(args...));
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+template <class ExecutionSpace, class Callable>
+bool graph_capture_call(ExecutionSpace const& exec, Callable const& callable) {
+  return graph_capture_record<GraphCapturedCall<Callable>>(exec, callable);
+}
+
+template <class ExecutionSpace>
+void graph_capture_fence(ExecutionSpace const& exec) {
+  if constexpr (is_graph_capturable_v<ExecutionSpace>) {
+    if (graph_capture_is_active()) graph_capture_fence(graph_capture_key(exec));
+  }
+}
+
+// </editor-fold> end GraphCapture }}}1
+//==============================================================================
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif  // KOKKOS_IMPL_GRAPH_CAPTURE_HPP
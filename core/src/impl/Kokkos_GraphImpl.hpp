@@ -51,6 +51,13 @@ struct GraphAccess {
         graph_impl_ptr, std::move(root_ptr)};
   }
 
+  template <class ExecutionSpace, class Capture>
+  static void add_captured_operations(
+      Kokkos::Experimental::Graph<ExecutionSpace>& arg_graph,
+      Capture const& arg_capture) {
+    arg_graph.m_impl_ptr->add_captured_operations(arg_capture);
+  }
+
   template <class NodeType, class... Args>
   static auto make_node_shared_ptr(Args&&... args) {
     static_assert(
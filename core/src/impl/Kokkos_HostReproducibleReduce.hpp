@@ -0,0 +1,135 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_HOST_REPRODUCIBLE_REDUCE_HPP
+#define KOKKOS_IMPL_HOST_REPRODUCIBLE_REDUCE_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief Reduction of a RangePolicy with the Experimental::Reproducible trait
+ *         on a host backend.
+ *
+ *  The iteration range is cut into blocks whose size only depends on the
+ *  length of the range and on an explicitly set chunk size. Each block is
+ *  reduced on its own, in any order and by any thread, and the block results
+ *  are then joined pairwise along a fixed binary tree. The result is thus the
+ *  same for any number of threads and any schedule.
+ */
+template <class Policy, class ReducerType>
+class HostReproducibleReduce {
+ public:
+  using pointer_type = typename ReducerType::pointer_type;
+  using Member       = typename Policy::member_type;
+
+  // Upper bound of the number of blocks, which bounds the memory used for the
+  // block results
+  static constexpr int64_t max_num_blocks = 1024;
+  // Smallest block when the chunk size is not set explicitly
+  static constexpr int64_t min_block_size = 256;
+
+  static constexpr size_t alignment = 64;
+
+  HostReproducibleReduce(const Policy& policy, const ReducerType& reducer)
+      : m_reducer(reducer),
+        m_begin(policy.begin()),
+        m_end(policy.end()),
+        m_block_size(block_size(policy)),
+        m_num_blocks(m_begin < m_end
+                         ? (m_end - m_begin + m_block_size - 1) / m_block_size
+                         : 0),
+        m_value_size(reducer.value_size()),
+        m_block_results(nullptr) {
+    // Not a HostSpace allocation: its deallocation fences, which would
+    // deadlock on the execution space instance held by the caller
+    if (0 < m_num_blocks) {
+      m_block_results = static_cast<char*>(
+          ::operator new(scratch_size(), std::align_val_t(alignment)));
+    }
+  }
+
+  HostReproducibleReduce(const HostReproducibleReduce&)            = delete;
+  HostReproducibleReduce& operator=(const HostReproducibleReduce&) = delete;
+
+  ~HostReproducibleReduce() {
+    if (m_block_results) {
+      ::operator delete(m_block_results, std::align_val_t(alignment));
+    }
+  }
+
+  int64_t num_blocks() const { return m_num_blocks; }
+
+  // exec_range(begin, end, update) reduces the iterations [begin, end)
+  template <class ExecRange>
+  void exec_block(const int64_t block, const ExecRange& exec_range) const {
+    const Member begin = m_begin + block * m_block_size;
+    const Member end   = static_cast<int64_t>(m_end - begin) < m_block_size
+                             ? m_end
+                             : static_cast<Member>(begin + m_block_size);
+    exec_range(begin, end, m_reducer.init(block_result(block)));
+  }
+
+  // Join the block results into result and apply final
+  void join(const pointer_type result) const {
+    if (m_num_blocks == 0) {
+      m_reducer.init(result);
+    } else {
+      for (int64_t stride = 1; stride < m_num_blocks; stride *= 2) {
+        for (int64_t i = 0; i + stride < m_num_blocks; i += 2 * stride) {
+          m_reducer.join(block_result(i), block_result(i + stride));
+        }
+      }
+      const pointer_type total = block_result(0);
+      const int count          = m_reducer.value_count();
+      for (int i = 0; i < count; ++i) result[i] = total[i];
+    }
+    m_reducer.final(result);
+  }
+
+ private:
+  static int64_t block_size(const Policy& policy) {
+    const int64_t length = policy.end() - policy.begin();
+    const int64_t min_size =
+        policy.impl_auto_chunk_size() ? min_block_size : policy.chunk_size();
+    return std::max(min_size, (length + max_num_blocks - 1) / max_num_blocks);
+  }
+
+  size_t scratch_size() const { return m_num_blocks * m_value_size; }
+
+  pointer_type block_result(const int64_t block) const {
+    return reinterpret_cast<pointer_type>(m_block_results +
+                                          block * m_value_size);
+  }
+
+  const ReducerType& m_reducer;
+  Member m_begin;
+  Member m_end;
+  int64_t m_block_size;
+  int64_t m_num_blocks;
+  size_t m_value_size;
+  char* m_block_results;
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,38 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <impl/Kokkos_HostSerialThreshold.hpp>
+
+#include <map>
+#include <mutex>
+
+namespace Kokkos {
+namespace Impl {
+
+HostSerialThreshold& get_host_serial_threshold(const std::string& label) {
+  static std::mutex mutex;
+  // std::map never moves its elements, so references stay valid
+  static std::map<std::string, HostSerialThreshold> thresholds;
+  std::lock_guard<std::mutex> lock(mutex);
+  return thresholds[label];
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
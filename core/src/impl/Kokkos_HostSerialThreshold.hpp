@@ -0,0 +1,84 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_HOST_SERIAL_THRESHOLD_HPP
+#define KOKKOS_IMPL_HOST_SERIAL_THRESHOLD_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief Learns for one kernel the number of iterations below which running
+ *         it serially on the calling thread is faster than using the thread
+ *         pool.
+ *
+ *  With c the cost of one iteration, o the overhead of forking and joining
+ *  the pool and p its size, a launch of n iterations takes c n serially and
+ *  about o + c n / p in parallel, so the pool only pays off for
+ *  n > o / (c (1 - 1 / p)).  The backend measures o; c is a moving average
+ *  over the measured launches of the kernel, serial or parallel.
+ */
+class HostSerialThreshold {
+ public:
+  static constexpr int64_t max_threshold = int64_t(1) << 24;
+
+ private:
+  // seconds per iteration, negative until a launch was measured
+  std::atomic<double> m_cost_per_iteration{-1.};
+
+  void record(double cost) {
+    const double old = m_cost_per_iteration.load(std::memory_order_relaxed);
+    m_cost_per_iteration.store(old < 0. ? cost : 0.75 * old + 0.25 * cost,
+                               std::memory_order_relaxed);
+  }
+
+ public:
+  double cost_per_iteration() const {
+    return m_cost_per_iteration.load(std::memory_order_relaxed);
+  }
+
+  int64_t threshold(double overhead, int pool_size) const {
+    const double cost = cost_per_iteration();
+    // the first launch uses the pool to get a measurement
+    if (cost < 0. || pool_size <= 1) return 0;
+    const double n = overhead / (cost * (1. - 1. / pool_size));
+    return n < double(max_threshold) ? int64_t(n) : max_threshold;
+  }
+
+  void record_serial(int64_t n, double seconds) {
+    if (n > 0) record(seconds / n);
+  }
+
+  void record_parallel(int64_t n, int pool_size, double overhead,
+                       double seconds) {
+    if (n > 0) record(std::max(seconds - overhead, 0.) * pool_size / n);
+  }
+};
+
+// The threshold learned for the kernels with the given label, looking it up
+// takes a lock
+HostSerialThreshold& get_host_serial_threshold(const std::string& label);
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,99 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_HOST_SLICED_JOIN_HPP
+#define KOKKOS_IMPL_HOST_SLICED_JOIN_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Impl {
+
+template <class ReducerType, class = void>
+struct host_reducer_has_elementwise_join : std::false_type {};
+
+template <class ReducerType>
+struct host_reducer_has_elementwise_join<
+    ReducerType, std::enable_if_t<ReducerType::has_elementwise_join()>>
+    : std::true_type {};
+
+template <class ReducerType>
+inline constexpr bool host_reducer_has_elementwise_join_v =
+    host_reducer_has_elementwise_join<ReducerType>::value;
+
+/** \brief Join of the per-thread partial results of a large array reduction
+ *         split across the threads of a host backend.
+ *
+ *  Instead of one thread joining all pool_size partial results, the values
+ *  are split into slices and every thread joins one slice of all the partial
+ *  results into the partial result of thread 0. Each value is still joined
+ *  in thread order, so the result is the same as joining serially.
+ *
+ *  Only valid for reducers with an element-wise join, see
+ *  host_reducer_has_elementwise_join.
+ */
+class HostSlicedJoin {
+ public:
+  // Below this many values per thread the synchronization costs more than
+  // what is saved by joining in parallel.
+  static constexpr int min_values_per_slice = 512;
+
+  HostSlicedJoin(const int value_count, const int pool_size)
+      : m_value_count(value_count),
+        m_num_slices(
+            std::clamp(value_count / min_values_per_slice, 1, pool_size)) {}
+
+  bool is_parallel() const { return 1 < m_num_slices; }
+
+  // partial(i) returns the partial result of thread i
+  template <class ValueType, class PartialResult>
+  void join(const int slice, const int num_partials,
+            const PartialResult& partial) const {
+    if (m_num_slices <= slice) return;
+
+    // Slice boundaries at cache line granularity to avoid false sharing
+    constexpr int align =
+        sizeof(ValueType) < 64 ? int(64 / sizeof(ValueType)) : 1;
+    const int begin = slice_boundary(slice, align);
+    const int end   = slice_boundary(slice + 1, align);
+
+    ValueType* const dst = partial(0);
+    for (int i = 1; i < num_partials; ++i) {
+      const ValueType* const src = partial(i);
+      for (int j = begin; j < end; ++j) dst[j] += src[j];
+    }
+  }
+
+ private:
+  int slice_boundary(const int slice, const int align) const {
+    if (slice == m_num_slices) return m_value_count;
+    const int boundary =
+        static_cast<int64_t>(m_value_count) * slice / m_num_slices;
+    return boundary - boundary % align;
+  }
+
+  int m_value_count;
+  int m_num_slices;
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -38,6 +38,13 @@
 #include <aligned_new>
 #endif
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#if defined(MREMAP_MAYMOVE)
+#define KOKKOS_IMPL_HOST_SPACE_MREMAP
+#endif
+#endif
+
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
@@ -75,9 +82,22 @@ void *HostSpace::impl_allocate(
 
   void *ptr = nullptr;
 
-  if (arg_alloc_size)
+  if (arg_alloc_size) {
+#ifdef KOKKOS_IMPL_HOST_SPACE_MREMAP
+    // Map large allocations directly so that they can be remapped
+    if (Impl::host_space_remap_threshold <= arg_alloc_size) {
+      ptr = mmap(nullptr, arg_alloc_size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (ptr == MAP_FAILED) ptr = nullptr;
+    } else {
+      ptr = operator new(arg_alloc_size, std::align_val_t(alignment),
+                         std::nothrow_t{});
+    }
+#else
     ptr = operator new(arg_alloc_size, std::align_val_t(alignment),
                        std::nothrow_t{});
+#endif
+  }
 
   if (!ptr || (reinterpret_cast<uintptr_t>(ptr) == ~uintptr_t(0)) ||
       (reinterpret_cast<uintptr_t>(ptr) & alignment_mask)) {
@@ -111,12 +131,66 @@ void HostSpace::impl_deallocate(
       Kokkos::Profiling::deallocateData(arg_handle, arg_label, arg_alloc_ptr,
                                         reported_size);
     }
+#ifdef KOKKOS_IMPL_HOST_SPACE_MREMAP
+    if (Impl::host_space_remap_threshold <= arg_alloc_size) {
+      munmap(arg_alloc_ptr, arg_alloc_size);
+      return;
+    }
+#endif
     constexpr uintptr_t alignment = Kokkos::Impl::MEMORY_ALIGNMENT;
     operator delete(arg_alloc_ptr, std::align_val_t(alignment),
                     std::nothrow_t{});
   }
 }
 
+namespace {
+double g_host_view_growth_factor = 1.5;
+}
+
+void Experimental::set_host_view_growth_factor(double factor) {
+  if (!(1. <= factor)) {
+    Impl::throw_runtime_exception(
+        "Kokkos::Experimental::set_host_view_growth_factor: the growth factor "
+        "must be at least 1");
+  }
+  g_host_view_growth_factor = factor;
+}
+
+double Experimental::get_host_view_growth_factor() noexcept {
+  return g_host_view_growth_factor;
+}
+
+namespace Impl {
+
+bool SharedAllocationRecord<HostSpace, void>::impl_try_grow(
+    const size_t arg_alloc_size) {
+  const size_t new_size = arg_alloc_size + sizeof(SharedAllocationHeader);
+#ifdef KOKKOS_IMPL_HOST_SPACE_MREMAP
+  if (new_size <= m_alloc_size || m_alloc_size < host_space_remap_threshold)
+    return false;
+
+  // Kernels may still access the memory
+  Kokkos::fence("HostSpace::impl_try_grow before remapping");
+  void* const ptr = mremap(m_alloc_ptr, m_alloc_size, new_size, MREMAP_MAYMOVE);
+  if (ptr == MAP_FAILED) return false;
+
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    const auto handle = Kokkos::Tools::make_space_handle(HostSpace::name());
+    Kokkos::Profiling::deallocateData(handle, m_label, m_alloc_ptr, size());
+    Kokkos::Profiling::allocateData(handle, m_label, ptr,
+                                    new_size - sizeof(SharedAllocationHeader));
+  }
+  m_alloc_ptr  = static_cast<SharedAllocationHeader*>(ptr);
+  m_alloc_size = new_size;
+  return true;
+#else
+  (void)new_size;
+  return false;
+#endif
+}
+
+}  // namespace Impl
+
 }  // namespace Kokkos
 
 #include <impl/Kokkos_SharedAlloc_timpl.hpp>
@@ -48,13 +48,24 @@ void hostspace_parallel_deepcopy_async(const ExecutionSpace& exec, void* dst,
                                        const void* src, ptrdiff_t n) {
   using policy_t = Kokkos::RangePolicy<ExecutionSpace>;
 
-  // If the asynchronous HPX backend is enabled, do *not* copy anything
-  // synchronously. The deep copy must be correctly sequenced with respect to
-  // other kernels submitted to the same instance, so we only use the fallback
-  // parallel_for version in this case.
-#if !(defined(KOKKOS_ENABLE_HPX) && \
-      defined(KOKKOS_ENABLE_IMPL_HPX_ASYNC_DISPATCH))
-  constexpr int host_deep_copy_serial_limit = 10 * 8192;
+  // If the asynchronous HPX or OpenMP backend is enabled, do *not* copy
+  // anything synchronously. The deep copy must be correctly sequenced with
+  // respect to other kernels submitted to the same instance, so we only use
+  // the fallback parallel_for version in this case.
+#if !(defined(KOKKOS_ENABLE_HPX) &&                      \
+      defined(KOKKOS_ENABLE_IMPL_HPX_ASYNC_DISPATCH)) && \
+    !(defined(KOKKOS_ENABLE_OPENMP) &&                   \
+      defined(KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH))
+  // When tuning internals on OpenMP, the copy kernels below learn on their
+  // own when to run serially (see Impl::HostSerialThreshold), so only copies
+  // too small to be worth a kernel launch are done here
+  int host_deep_copy_serial_limit = 10 * 8192;
+#if defined(KOKKOS_ENABLE_OPENMP) && defined(KOKKOS_ENABLE_TUNING)
+  if (std::is_same_v<ExecutionSpace, Kokkos::OpenMP> &&
+      Kokkos::tune_internals()) {
+    host_deep_copy_serial_limit = 8192;
+  }
+#endif
   if ((n < host_deep_copy_serial_limit) || (exec.concurrency() == 1)) {
     if (0 < n) std::memcpy(dst, src, n);
     return;
@@ -310,6 +310,20 @@ class HostThreadTeamData {
     return total_bytes;
   }
 
+  // Given:
+  //   old_size       = number bytes currently allocated for a part
+  //   requested_size = number bytes a kernel needs for that part
+  // Return:
+  //   number bytes to allocate for that part, which never shrinks and grows
+  //   by at least half so that slowly increasing requests do not reallocate
+  //   the scratch memory at every kernel
+  static constexpr size_t scratch_high_water_mark(size_t old_size,
+                                                  size_t requested_size) {
+    return requested_size <= old_size
+               ? old_size
+               : std::max(requested_size, old_size + old_size / 2);
+  }
+
   // Given:
   //   alloc_ptr         = pointer to allocated memory
   //   alloc_size        = number bytes of allocated memory
@@ -0,0 +1,164 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_HOST_WORKGRAPH_QUEUE_HPP
+#define KOKKOS_HOST_WORKGRAPH_QUEUE_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Atomic.hpp>
+
+#include <cstdint>
+#include <memory>
+
+namespace Kokkos {
+namespace Impl {
+
+// class HostWorkGraphQueue
+//
+// Executes a WorkGraphPolicy on the threads of a host thread pool, keeping
+// most of the ready work out of the shared ready queue of the policy, whose
+// begin and end hints every thread would otherwise update.
+//
+// * A thread runs next the first successor made ready by the work it just
+//   completed, so that a chain of work stays on the same thread.
+// * The other successors it made ready go to a small ready list of the thread,
+//   one cache line, and only go to the shared ready queue once it is full.
+// * An idle thread takes work from its own list, then from the shared ready
+//   queue, then steals from the lists of the other threads.
+// * The threads count their completed work locally and only add it to the
+//   shared count when idle, to detect that all the work has been completed.
+template <class Policy>
+class HostWorkGraphQueue {
+ public:
+  HostWorkGraphQueue(Policy const& policy, int pool_size)
+      : m_policy(policy),
+        m_pool_size(pool_size),
+        m_lists(new ReadyList[pool_size]) {
+    for (int rank = 0; rank < pool_size; ++rank) {
+      for (auto& w : m_lists[rank].work) w = Policy::END_TOKEN;
+    }
+  }
+
+  // Called by each thread of the pool with its rank, returns once all the
+  // work has been completed
+  template <class RunWork>
+  void execute(const int rank, RunWork const& run_work) {
+    ReadyList& own       = m_lists[rank];
+    std::int32_t next    = Policy::END_TOKEN;
+    std::int32_t num_run = 0;
+
+    for (;;) {
+      std::int32_t w = next;
+      next           = Policy::END_TOKEN;
+      if (Policy::END_TOKEN == w) w = pop(own);
+      if (Policy::END_TOKEN == w) {
+        w = m_policy.pop_work();
+        if (Policy::COMPLETED_TOKEN == w) break;
+      }
+      if (Policy::END_TOKEN == w) w = steal(rank);
+
+      if (Policy::END_TOKEN != w) {
+        run_work(w);
+        m_policy.completed_work(w, [&](const std::int32_t ready) {
+          if (Policy::END_TOKEN == next) {
+            next = ready;
+            return true;
+          }
+          return push(own, ready);
+        });
+        ++num_run;
+      } else {
+        if (num_run != 0) {
+          Kokkos::atomic_add(&m_num_completed.value, num_run);
+          num_run = 0;
+        }
+        if (Kokkos::atomic_load(&m_num_completed.value) ==
+            m_policy.impl_work_count()) {
+          break;
+        }
+      }
+    }
+    // all the work went through the shared ready queue
+    if (num_run != 0) Kokkos::atomic_add(&m_num_completed.value, num_run);
+  }
+
+ private:
+  static constexpr int ready_list_capacity = 15;
+
+  struct alignas(64) ReadyList {
+    std::int32_t work[ready_list_capacity];
+  };
+
+  struct alignas(64) Counter {
+    std::int32_t value = 0;
+  };
+
+  // Only the owner of a list fills its slots, other threads only empty them
+  static bool push(ReadyList& list, const std::int32_t w) {
+    for (auto& slot : list.work) {
+      if (Policy::END_TOKEN == Kokkos::atomic_load(&slot)) {
+        Kokkos::atomic_store(&slot, w);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // The owner takes the most recently filled slots first, the thieves the
+  // oldest ones
+  static std::int32_t pop(ReadyList& list) {
+    for (int i = ready_list_capacity - 1; i >= 0; --i) {
+      const std::int32_t w = claim(list.work[i]);
+      if (Policy::END_TOKEN != w) return w;
+    }
+    return Policy::END_TOKEN;
+  }
+
+  std::int32_t steal(const int rank) {
+    for (int i = 1; i < m_pool_size; ++i) {
+      ReadyList& victim = m_lists[(rank + i) % m_pool_size];
+      for (auto& slot : victim.work) {
+        const std::int32_t w = claim(slot);
+        if (Policy::END_TOKEN != w) {
+          // see the memory accesses of the work that made w ready
+          Kokkos::memory_fence();
+          return w;
+        }
+      }
+    }
+    return Policy::END_TOKEN;
+  }
+
+  static std::int32_t claim(std::int32_t& slot) {
+    const std::int32_t w = Kokkos::atomic_load(&slot);
+    if (Policy::END_TOKEN != w &&
+        w == Kokkos::atomic_compare_exchange(
+                 &slot, w, static_cast<std::int32_t>(Policy::END_TOKEN))) {
+      return w;
+    }
+    return Policy::END_TOKEN;
+  }
+
+  Policy const& m_policy;
+  const int m_pool_size;
+  std::unique_ptr<ReadyList[]> m_lists;
+  Counter m_num_completed;
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif  // KOKKOS_HOST_WORKGRAPH_QUEUE_HPP
@@ -0,0 +1,460 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <impl/Kokkos_Profiling.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*--------------------------------------------------------------------------*/
+/* The kernel statistics register themselves as the callbacks of a tool. The
+ * callbacks of the kernels and deep copies only update the tables of the
+ * calling thread, which are merged when the report is printed, and only lock
+ * when a thread registers its table. A kernel may end on another thread than
+ * the one that began it, so the kernel ID encodes the table of the beginning
+ * thread and the slot in which it keeps the kernel in flight. The ending
+ * thread adds the time to the record atomically and frees the slot, which the
+ * owner then reuses. The kernel events are fenced as for any tool requiring
+ * global fencing, so that the times are the ones of the kernels and not of
+ * their launches.
+ *
+ * The memory allocated in each space is counted in a few global atomics,
+ * since a high-water mark is a property of all the threads together.
+ */
+/*--------------------------------------------------------------------------*/
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+enum KernelKind { parallel_for, parallel_reduce, parallel_scan, num_kinds };
+
+constexpr const char* kernel_kind_names[num_kinds] = {"for", "reduce", "scan"};
+
+// Statistics of a kernel label, updated atomically since the kernels of a
+// thread may end on other threads
+struct KernelRecord {
+  std::atomic<uint64_t> count{0};
+  std::atomic<double> total{0.};
+  std::atomic<double> min{std::numeric_limits<double>::max()};
+  std::atomic<double> max{0.};
+
+  template <class Op>
+  static void update(std::atomic<double>& value, double time, Op op) {
+    double old = value.load(std::memory_order_relaxed);
+    while (!value.compare_exchange_weak(old, op(old, time),
+                                        std::memory_order_relaxed)) {
+    }
+  }
+
+  void add(double time) {
+    count.fetch_add(1, std::memory_order_relaxed);
+    update(total, time, std::plus<>());
+    update(min, time, [](double a, double b) { return std::min(a, b); });
+    update(max, time, [](double a, double b) { return std::max(a, b); });
+  }
+};
+
+// Merged statistics of a kernel label, as printed in the report
+struct KernelSummary {
+  uint64_t count = 0;
+  double total   = 0.;
+  double min     = std::numeric_limits<double>::max();
+  double max     = 0.;
+
+  void add(KernelRecord const& record) {
+    count += record.count.load(std::memory_order_relaxed);
+    total += record.total.load(std::memory_order_relaxed);
+    min = std::min(min, record.min.load(std::memory_order_relaxed));
+    max = std::max(max, record.max.load(std::memory_order_relaxed));
+  }
+};
+
+struct DeepCopyRecord {
+  uint64_t count = 0;
+  uint64_t bytes = 0;
+  double total   = 0.;
+};
+
+// Append-only array whose elements keep their address. Elements are appended
+// by one thread at a time, while any thread may access the appended ones.
+template <class T>
+class ChunkedArray {
+  static constexpr size_t chunk_size = 32;
+
+  struct Chunk {
+    T elements[chunk_size];
+    std::atomic<Chunk*> next{nullptr};
+  };
+
+  Chunk m_first;
+  Chunk* m_last = &m_first;
+  std::atomic<size_t> m_size{0};
+
+ public:
+  ChunkedArray()                               = default;
+  ChunkedArray(ChunkedArray const&)            = delete;
+  ChunkedArray& operator=(ChunkedArray const&) = delete;
+
+  ~ChunkedArray() {
+    for (Chunk* chunk = m_first.next.load(); chunk != nullptr;) {
+      Chunk* next = chunk->next.load();
+      delete chunk;
+      chunk = next;
+    }
+  }
+
+  size_t size() const { return m_size.load(std::memory_order_acquire); }
+
+  T& operator[](size_t i) {
+    Chunk* chunk = &m_first;
+    for (; i >= chunk_size; i -= chunk_size) {
+      chunk = chunk->next.load(std::memory_order_acquire);
+    }
+    return chunk->elements[i];
+  }
+
+  T& emplace_back() {
+    const size_t i = m_size.load(std::memory_order_relaxed);
+    if (i > 0 && i % chunk_size == 0) {
+      auto* chunk = new Chunk;
+      m_last->next.store(chunk, std::memory_order_release);
+      m_last = chunk;
+    }
+    m_size.store(i + 1, std::memory_order_release);
+    return m_last->elements[i % chunk_size];
+  }
+};
+
+// A kernel that began and did not end yet. The slot is only taken by the
+// thread owning it, and freed by the thread ending the kernel.
+struct KernelInFlight {
+  KernelRecord* record = nullptr;
+  clock_type::time_point start;
+  std::atomic<bool> busy{false};
+};
+
+struct ThreadStatistics {
+  // index in all_thread_statistics(), the upper half of the kernel IDs
+  uint32_t index = 0;
+  std::unordered_map<std::string, KernelRecord> kernels[num_kinds];
+  // the lower half of the kernel IDs
+  ChunkedArray<KernelInFlight> kernels_in_flight;
+  // keyed by "destination <- source"
+  std::unordered_map<std::string, DeepCopyRecord> deep_copies;
+  // reused to look the labels up without allocating at every launch
+  std::string key;
+  DeepCopyRecord* active_deep_copy = nullptr;
+  clock_type::time_point deep_copy_start;
+
+  void clear() {
+    for (auto& kernels_of_kind : kernels) kernels_of_kind.clear();
+    deep_copies.clear();
+    active_deep_copy = nullptr;
+  }
+};
+
+// The tables outlive their threads, they are only cleared at finalize
+std::mutex& thread_statistics_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+ChunkedArray<ThreadStatistics>& all_thread_statistics() {
+  static ChunkedArray<ThreadStatistics> tables;
+  return tables;
+}
+
+ThreadStatistics& thread_statistics() {
+  thread_local ThreadStatistics* table = nullptr;
+  if (table == nullptr) {
+    std::lock_guard<std::mutex> lock(thread_statistics_mutex());
+    auto& tables = all_thread_statistics();
+    const auto index = static_cast<uint32_t>(tables.size());
+    table            = &tables.emplace_back();
+    table->index     = index;
+  }
+  return *table;
+}
+
+struct SpaceRecord {
+  char name[64] = {};
+  std::atomic<int64_t> current{0};
+  std::atomic<int64_t> high_water{0};
+  std::atomic<uint64_t> allocations{0};
+};
+
+constexpr int max_spaces = 16;
+SpaceRecord space_records[max_spaces];
+std::atomic<int> num_space_records{0};
+std::mutex space_records_mutex;
+
+SpaceRecord* find_space_record(SpaceHandle const& handle) {
+  auto find = [&](int begin, int end) -> SpaceRecord* {
+    for (int i = begin; i < end; ++i) {
+      if (std::strncmp(space_records[i].name, handle.name,
+                       sizeof(handle.name)) == 0) {
+        return &space_records[i];
+      }
+    }
+    return nullptr;
+  };
+  const int num_spaces = num_space_records.load(std::memory_order_acquire);
+  if (auto* record = find(0, num_spaces)) return record;
+
+  std::lock_guard<std::mutex> lock(space_records_mutex);
+  const int num_spaces_now = num_space_records.load(std::memory_order_relaxed);
+  if (auto* record = find(num_spaces, num_spaces_now)) return record;
+  if (num_spaces_now == max_spaces) return nullptr;
+  SpaceRecord& record = space_records[num_spaces_now];
+  // the zero initialized name keeps its terminating null character
+  std::memcpy(record.name, handle.name,
+              std::min(std::strlen(handle.name), sizeof(record.name) - 1));
+  num_space_records.store(num_spaces_now + 1, std::memory_order_release);
+  return &record;
+}
+
+double seconds_since(clock_type::time_point start) {
+  return std::chrono::duration<double>(clock_type::now() - start).count();
+}
+
+template <KernelKind kind>
+void begin_kernel(const char* name, const uint32_t /*devID*/,
+                  uint64_t* kernelID) {
+  auto& table = thread_statistics();
+  table.key.assign(name);
+  auto found = table.kernels[kind].find(table.key);
+  if (found == table.kernels[kind].end()) {
+    found = table.kernels[kind].try_emplace(table.key).first;
+  }
+
+  // the slots freed by the kernels that ended are reused, so that the table
+  // stops growing
+  auto& in_flight = table.kernels_in_flight;
+  size_t slot     = 0;
+  while (slot < in_flight.size() &&
+         in_flight[slot].busy.load(std::memory_order_acquire)) {
+    ++slot;
+  }
+  auto& kernel = slot < in_flight.size() ? in_flight[slot]
+                                         : in_flight.emplace_back();
+  kernel.record = &found->second;
+  kernel.busy.store(true, std::memory_order_relaxed);
+  *kernelID    = (uint64_t(table.index) << 32) | slot;
+  kernel.start = clock_type::now();
+}
+
+void end_kernel(const uint64_t kernelID) {
+  const auto end     = clock_type::now();
+  auto& tables       = all_thread_statistics();
+  const size_t index = kernelID >> 32;
+  const size_t slot  = kernelID & 0xffffffff;
+  if (index >= tables.size()) return;
+  auto& in_flight = tables[index].kernels_in_flight;
+  if (slot >= in_flight.size()) return;
+  auto& kernel = in_flight[slot];
+  if (!kernel.busy.load(std::memory_order_relaxed)) return;
+  kernel.record->add(std::chrono::duration<double>(end - kernel.start).count());
+  // hands the slot back to the owner
+  kernel.busy.store(false, std::memory_order_release);
+}
+
+void begin_deep_copy(SpaceHandle dst_handle, const char* /*dst_name*/,
+                     const void* /*dst_ptr*/, SpaceHandle src_handle,
+                     const char* /*src_name*/, const void* /*src_ptr*/,
+                     uint64_t size) {
+  auto& table = thread_statistics();
+  table.key.assign(dst_handle.name);
+  table.key.append(" <- ");
+  table.key.append(src_handle.name);
+  auto& record = table.deep_copies[table.key];
+  ++record.count;
+  record.bytes += size;
+  table.active_deep_copy = &record;
+  table.deep_copy_start  = clock_type::now();
+}
+
+void end_deep_copy() {
+  auto& table = thread_statistics();
+  if (table.active_deep_copy == nullptr) return;
+  table.active_deep_copy->total += seconds_since(table.deep_copy_start);
+  table.active_deep_copy = nullptr;
+}
+
+void allocate_data(SpaceHandle handle, const char* /*name*/,
+                   const void* /*ptr*/, uint64_t size) {
+  auto* record = find_space_record(handle);
+  if (record == nullptr) return;
+  const auto bytes = static_cast<int64_t>(size);
+  record->allocations.fetch_add(1, std::memory_order_relaxed);
+  const int64_t current =
+      record->current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  int64_t high_water = record->high_water.load(std::memory_order_relaxed);
+  while (high_water < current &&
+         !record->high_water.compare_exchange_weak(
+             high_water, current, std::memory_order_relaxed)) {
+  }
+}
+
+void deallocate_data(SpaceHandle handle, const char* /*name*/,
+                     const void* /*ptr*/, uint64_t size) {
+  auto* record = find_space_record(handle);
+  if (record == nullptr) return;
+  record->current.fetch_sub(static_cast<int64_t>(size),
+                            std::memory_order_relaxed);
+}
+
+void finalize_kernel_statistics() {
+  print_kernel_statistics(std::cout);
+  {
+    std::lock_guard<std::mutex> lock(thread_statistics_mutex());
+    auto& tables = all_thread_statistics();
+    for (size_t i = 0; i < tables.size(); ++i) tables[i].clear();
+  }
+  std::lock_guard<std::mutex> lock(space_records_mutex);
+  for (int i = 0; i < num_space_records.load(); ++i) {
+    space_records[i].current     = 0;
+    space_records[i].high_water  = 0;
+    space_records[i].allocations = 0;
+  }
+}
+
+}  // namespace
+
+void initialize_kernel_statistics() {
+  if (profileLibraryLoaded()) {
+    if (Kokkos::show_warnings()) {
+      std::cerr << "Warning: the kernel statistics are disabled because a "
+                   "tool is already loaded. Raised by Kokkos::initialize()."
+                << std::endl;
+    }
+    return;
+  }
+  using namespace Kokkos::Tools::Experimental;
+  set_begin_parallel_for_callback(begin_kernel<parallel_for>);
+  set_begin_parallel_reduce_callback(begin_kernel<parallel_reduce>);
+  set_begin_parallel_scan_callback(begin_kernel<parallel_scan>);
+  set_end_parallel_for_callback(end_kernel);
+  set_end_parallel_reduce_callback(end_kernel);
+  set_end_parallel_scan_callback(end_kernel);
+  set_begin_deep_copy_callback(begin_deep_copy);
+  set_end_deep_copy_callback(end_deep_copy);
+  set_allocate_data_callback(allocate_data);
+  set_deallocate_data_callback(deallocate_data);
+  set_finalize_callback(finalize_kernel_statistics);
+}
+
+void print_kernel_statistics(std::ostream& os) {
+  using kernel_key = std::pair<std::string, int>;
+  std::vector<std::pair<kernel_key, KernelSummary>> kernels;
+  std::vector<std::pair<std::string, DeepCopyRecord>> deep_copies;
+  {
+    std::lock_guard<std::mutex> lock(thread_statistics_mutex());
+    std::map<kernel_key, KernelSummary> merged_kernels;
+    std::map<std::string, DeepCopyRecord> merged_deep_copies;
+    auto& tables = all_thread_statistics();
+    for (size_t i = 0; i < tables.size(); ++i) {
+      auto const& table = tables[i];
+      for (int kind = 0; kind < num_kinds; ++kind) {
+        for (auto const& [name, record] : table.kernels[kind]) {
+          if (record.count > 0) merged_kernels[{name, kind}].add(record);
+        }
+      }
+      for (auto const& [spaces, record] : table.deep_copies) {
+        auto& merged = merged_deep_copies[spaces];
+        merged.count += record.count;
+        merged.bytes += record.bytes;
+        merged.total += record.total;
+      }
+    }
+    kernels.assign(merged_kernels.begin(), merged_kernels.end());
+    deep_copies.assign(merged_deep_copies.begin(), merged_deep_copies.end());
+  }
+  std::stable_sort(kernels.begin(), kernels.end(),
+                   [](auto const& lhs, auto const& rhs) {
+                     return lhs.second.total > rhs.second.total;
+                   });
+
+  const auto flags     = os.flags();
+  const auto precision = os.precision();
+  os << std::scientific << std::setprecision(3);
+
+  os << "Kokkos kernel statistics\n";
+  os << "  Kernels:\n"
+     << "    " << std::setw(10) << "total [s]" << std::setw(11) << "launches"
+     << std::setw(11) << "mean [s]" << std::setw(11) << "min [s]"
+     << std::setw(11) << "max [s]"
+     << "  type    label\n";
+  for (auto const& [key, record] : kernels) {
+    os << "    " << std::setw(10) << record.total << std::setw(11)
+       << record.count << std::setw(11) << record.total / record.count
+       << std::setw(11) << record.min << std::setw(11) << record.max << "  "
+       << std::left << std::setw(8) << kernel_kind_names[key.second]
+       << std::right << key.first << '\n';
+  }
+
+  os << "  Deep copies:\n"
+     << "    " << std::setw(10) << "total [s]" << std::setw(11) << "copies"
+     << std::setw(16) << "bytes"
+     << "  destination <- source\n";
+  for (auto const& [spaces, record] : deep_copies) {
+    os << "    " << std::setw(10) << record.total << std::setw(11)
+       << record.count << std::setw(16) << record.bytes << "  " << spaces
+       << '\n';
+  }
+
+  os << "  Memory spaces:\n"
+     << "    " << std::setw(16) << "high-water [B]" << std::setw(13)
+     << "allocations" << std::setw(16) << "current [B]"
+     << "  space\n";
+  {
+    std::lock_guard<std::mutex> lock(space_records_mutex);
+    for (int i = 0; i < num_space_records.load(); ++i) {
+      auto const& record = space_records[i];
+      if (record.allocations.load() == 0) continue;
+      os << "    " << std::setw(16) << record.high_water.load()
+         << std::setw(13) << record.allocations.load() << std::setw(16)
+         << record.current.load() << "  " << record.name << '\n';
+    }
+  }
+
+  os.flags(flags);
+  os.precision(precision);
+}
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
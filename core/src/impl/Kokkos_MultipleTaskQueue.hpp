@@ -33,6 +33,7 @@
 #include <Kokkos_Atomic.hpp>
 #include <impl/Kokkos_OptionalRef.hpp>
 #include <impl/Kokkos_LIFO.hpp>
+#include <Kokkos_hwloc.hpp>
 
 #include <string>
 #include <typeinfo>
@@ -86,6 +87,11 @@ struct MultipleTaskQueueTeamEntry {
 
   task_base_type* m_failed_heads[NumPriorities][2];
 
+  // Only touched by the team owning this entry, so no atomics are needed
+  uint32_t m_steal_rng_state = 0;
+  uint64_t m_steal_count     = 0;
+  uint64_t m_failed_steals   = 0;
+
   KOKKOS_INLINE_FUNCTION
   task_base_type*& failed_head_for(runnable_task_base_type const& task) {
     return m_failed_heads[int(task.get_priority())][int(task.get_task_type())];
@@ -128,6 +134,32 @@ struct MultipleTaskQueueTeamEntry {
     }
   }
 
+  /// xorshift32 generator used to pick steal victims
+  KOKKOS_INLINE_FUNCTION
+  uint32_t next_steal_random(uint32_t seed) {
+    uint32_t x = m_steal_rng_state;
+    if (x == 0) x = (seed + 1u) * 2654435761u | 1u;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    m_steal_rng_state = x;
+    return x;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void record_steal(bool success) {
+    if (success)
+      ++m_steal_count;
+    else
+      ++m_failed_steals;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t steal_count() const { return m_steal_count; }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t failed_steal_count() const { return m_failed_steals; }
+
   KOKKOS_INLINE_FUNCTION
   OptionalRef<task_base_type> try_to_steal_ready_task() {
     auto return_value = OptionalRef<task_base_type>{};
@@ -258,6 +290,14 @@ struct MultipleTaskQueueTeamEntry {
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
+/// Work stealing counters of a MultipleTaskQueue, summed over its team queues
+struct MultipleTaskQueueStatistics {
+  /// Number of tasks taken from another team's queue
+  uint64_t steals = 0;
+  /// Number of times a team looked for a task to steal without finding one
+  uint64_t failed_steals = 0;
+};
+
 template <class ExecSpace, class MemorySpace, class TaskQueueTraits,
           class MemoryPool>
 class MultipleTaskQueue final
@@ -342,6 +382,60 @@ class MultipleTaskQueue final
     return this->n_vla_entries();
   }
 
+ private:
+  // Victims are first searched for among the team queues in the same group
+  // of consecutive queues (i.e., threads bound close to each other) as the
+  // thief, and only then among all the other queues.
+  int32_t m_steal_group_size = 1;
+
+  static int32_t default_steal_group_size(int32_t n_queues) {
+    if constexpr (SpaceAccessibility<HostSpace,
+                                     typename ExecSpace::memory_space>::
+                      accessible) {
+      if (Kokkos::hwloc::available() &&
+          Kokkos::hwloc::get_available_numa_count() > 1) {
+        const int32_t n_numa = Kokkos::hwloc::get_available_numa_count();
+        return (n_queues + n_numa - 1) / n_numa;
+      }
+    }
+    return n_queues;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  OptionalRef<task_base_type> steal_ready_task(int32_t thief) {
+    auto return_value = OptionalRef<task_base_type>{};
+    auto& thief_info  = this->vla_value_at(thief);
+
+    const int32_t n_queues    = this->n_queues();
+    const int32_t group_size  = m_steal_group_size;
+    const int32_t group_begin = (thief / group_size) * group_size;
+    const int32_t group_count = n_queues - group_begin < group_size
+                                    ? n_queues - group_begin
+                                    : group_size;
+
+    // randomized start within the thief's own group first ...
+    int32_t start = thief_info.next_steal_random(thief) % group_count;
+    for (int32_t i = 0; i < group_count && !return_value; ++i) {
+      const int32_t victim = group_begin + (start + i) % group_count;
+      if (victim == thief) continue;
+      return_value = this->vla_value_at(victim).try_to_steal_ready_task();
+    }
+
+    // ... then a randomized start over the remaining queues
+    if (!return_value && group_count < n_queues) {
+      start = thief_info.next_steal_random(thief) % n_queues;
+      for (int32_t i = 0; i < n_queues && !return_value; ++i) {
+        const int32_t victim = (start + i) % n_queues;
+        if (victim >= group_begin && victim < group_begin + group_count)
+          continue;
+        return_value = this->vla_value_at(victim).try_to_steal_ready_task();
+      }
+    }
+
+    thief_info.record_steal(bool(return_value));
+    return return_value;
+  }
+
  public:
   //----------------------------------------------------------------------------
   // <editor-fold desc="Constructors, destructors, and assignment"> {{{2
@@ -362,7 +456,8 @@ class MultipleTaskQueue final
                 // SimpleTaskScheduler directly?
                 SimpleTaskScheduler<typename base_t::execution_space,
                                     MultipleTaskQueue>>::
-                get_max_team_count(arg_execution_space)) {}
+                get_max_team_count(arg_execution_space)),
+        m_steal_group_size(default_steal_group_size(n_queues())) {}
 
   // </editor-fold> end Constructors, destructors, and assignment }}}2
   //----------------------------------------------------------------------------
@@ -400,16 +495,8 @@ class MultipleTaskQueue final
 
     return_value = team_queue_info.pop_ready_task();
 
-    if (!return_value) {
-      // loop through the rest of the teams and try to steal
-      for (auto isteal = (team_association + 1) % this->n_queues();
-           isteal != team_association;
-           isteal = (isteal + 1) % this->n_queues()) {
-        return_value = this->vla_value_at(isteal).try_to_steal_ready_task();
-        if (return_value) {
-          break;
-        }
-      }
+    if (!return_value && this->n_queues() > 1) {
+      return_value = steal_ready_task(team_association);
 
       // Note that this is where we'd update the task's scheduling info
     }
@@ -417,6 +504,17 @@ class MultipleTaskQueue final
     return return_value;
   }
 
+  /// Work stealing counters accumulated since the queue was created.  Only
+  /// the OpenMP backend reports them to the tools so far.
+  MultipleTaskQueueStatistics impl_statistics() const {
+    MultipleTaskQueueStatistics stats;
+    for (int32_t i = 0; i < int32_t(n_queues()); ++i) {
+      stats.steals += this->vla_value_at(i).steal_count();
+      stats.failed_steals += this->vla_value_at(i).failed_steal_count();
+    }
+    return stats;
+  }
+
   // TODO @tasking @generalization DSH make this a property-based customization
   // point
   KOKKOS_INLINE_FUNCTION
@@ -26,6 +26,7 @@
 #include <impl/Kokkos_Profiling.hpp>
 #include <impl/Kokkos_Profiling_Interface.hpp>
 #include <impl/Kokkos_Command_Line_Parsing.hpp>
+#include <impl/Kokkos_HostSerialThreshold.hpp>
 
 #if defined(KOKKOS_ENABLE_LIBDL) || defined(KOKKOS_TOOLS_INDEPENDENT_BUILD)
 #include <dlfcn.h>
@@ -233,6 +234,7 @@ void tool_invoked_fence(const uint32_t /* devID */) {
 #ifdef KOKKOS_ENABLE_TUNING
 static size_t kernel_name_context_variable_id;
 static size_t kernel_type_context_variable_id;
+static size_t host_serial_threshold_variable_id;
 static std::unordered_map<size_t, std::unordered_set<size_t>>
     features_per_context;
 static std::unordered_set<size_t> active_features;
@@ -255,6 +257,7 @@ bool eventSetsEqual(const EventSet& l, const EventSet& r) {
          l.push_region == r.push_region && l.pop_region == r.pop_region &&
          l.allocate_data == r.allocate_data &&
          l.deallocate_data == r.deallocate_data &&
+         l.resize_scratch == r.resize_scratch &&
          l.create_profile_section == r.create_profile_section &&
          l.start_profile_section == r.start_profile_section &&
          l.stop_profile_section == r.stop_profile_section &&
@@ -288,8 +291,10 @@ inline void invoke_kokkosp_callback(
     if (may_require_global_fencing == MayRequireGlobalFencing::Yes &&
         (tool_requirements.requires_global_fencing)) {
 #ifndef KOKKOS_TOOLS_INDEPENDENT_BUILD
-      Kokkos::fence(
-          "Kokkos::Tools::invoke_kokkosp_callback: Kokkos Profile Tool Fence");
+      // built once, fencing around every kernel does not allocate the name
+      static const std::string fence_name =
+          "Kokkos::Tools::invoke_kokkosp_callback: Kokkos Profile Tool Fence";
+      Kokkos::fence(fence_name);
 #endif
     }
     (*callback)(std::forward<Args>(args)...);
@@ -422,6 +427,13 @@ void deallocateData(const SpaceHandle space, const std::string label,
       ptr, size);
 }
 
+void resizeScratch(const SpaceHandle space, const uint64_t old_size,
+                   const uint64_t size) {
+  Experimental::invoke_kokkosp_callback(
+      Experimental::MayRequireGlobalFencing::No,
+      Experimental::current_callbacks.resize_scratch, space, old_size, size);
+}
+
 void beginDeepCopy(const SpaceHandle dst_space, const std::string dst_label,
                    const void* dst_ptr, const SpaceHandle src_space,
                    const std::string src_label, const void* src_ptr,
@@ -460,7 +472,7 @@ void endDeepCopy() {
 #endif
 }
 
-void beginFence(const std::string name, const uint32_t deviceId,
+void beginFence(const std::string& name, const uint32_t deviceId,
                 uint64_t* handle) {
   Experimental::invoke_kokkosp_callback(
       Experimental::MayRequireGlobalFencing::No,
@@ -617,12 +629,64 @@ void initialize(const std::string& profileLibrary) {
         actions);
   };
 
+  // Declared even without a tool library, for the tools whose callbacks are
+  // set programmatically
+  auto declare_tuning_variables = []() {
+#ifdef KOKKOS_ENABLE_TUNING
+    Experimental::VariableInfo kernel_name;
+    kernel_name.type = Experimental::ValueType::kokkos_value_string;
+    kernel_name.category =
+        Experimental::StatisticalCategory::kokkos_value_categorical;
+    kernel_name.valueQuantity =
+        Experimental::CandidateValueType::kokkos_value_unbounded;
+
+    std::array<std::string, 4> candidate_values = {
+        "parallel_for",
+        "parallel_reduce",
+        "parallel_scan",
+        "parallel_copy",
+    };
+
+    Experimental::SetOrRange kernel_type_variable_candidates =
+        Experimental::make_candidate_set(4, candidate_values.data());
+
+    Experimental::kernel_name_context_variable_id =
+        Experimental::declare_input_type("kokkos.kernel_name", kernel_name);
+
+    Experimental::VariableInfo kernel_type;
+    kernel_type.type = Experimental::ValueType::kokkos_value_string;
+    kernel_type.category =
+        Experimental::StatisticalCategory::kokkos_value_categorical;
+    kernel_type.valueQuantity =
+        Experimental::CandidateValueType::kokkos_value_set;
+    kernel_type.candidates = kernel_type_variable_candidates;
+    Experimental::kernel_type_context_variable_id =
+        Experimental::declare_input_type("kokkos.kernel_type", kernel_type);
+
+    // Tools choose the serial threshold of host range launches, the kernel is
+    // given by the kokkos.kernel_name input of the launch's context
+    Experimental::VariableInfo serial_threshold;
+    serial_threshold.type = Experimental::ValueType::kokkos_value_int64;
+    serial_threshold.category =
+        Experimental::StatisticalCategory::kokkos_value_ratio;
+    serial_threshold.valueQuantity =
+        Experimental::CandidateValueType::kokkos_value_range;
+    serial_threshold.candidates = Experimental::make_candidate_range(
+        int64_t(0), Kokkos::Impl::HostSerialThreshold::max_threshold,
+        int64_t(1), false, false);
+    Experimental::host_serial_threshold_variable_id =
+        Experimental::declare_output_type("kokkos.host_serial_threshold",
+                                          serial_threshold);
+#endif
+  };
+
 #ifdef KOKKOS_TOOLS_ENABLE_LIBDL
   void* firstProfileLibrary = nullptr;
 
   if ((profileLibrary.empty()) ||
       (profileLibrary == InitArguments::unset_string_option)) {
     invoke_init_callbacks();
+    declare_tuning_variables();
     return;
   }
 
@@ -665,6 +729,8 @@ void initialize(const std::string& profileLibrary) {
                       Experimental::current_callbacks.allocate_data);
       lookup_function(firstProfileLibrary, "kokkosp_deallocate_data",
                       Experimental::current_callbacks.deallocate_data);
+      lookup_function(firstProfileLibrary, "kokkosp_resize_scratch",
+                      Experimental::current_callbacks.resize_scratch);
 
       lookup_function(firstProfileLibrary, "kokkosp_begin_deep_copy",
                       Experimental::current_callbacks.begin_deep_copy);
@@ -725,39 +791,8 @@ void initialize(const std::string& profileLibrary) {
 #endif  // KOKKOS_ENABLE_LIBDL
 
   invoke_init_callbacks();
+  declare_tuning_variables();
 
-#ifdef KOKKOS_ENABLE_TUNING
-  Experimental::VariableInfo kernel_name;
-  kernel_name.type = Experimental::ValueType::kokkos_value_string;
-  kernel_name.category =
-      Experimental::StatisticalCategory::kokkos_value_categorical;
-  kernel_name.valueQuantity =
-      Experimental::CandidateValueType::kokkos_value_unbounded;
-
-  std::array<std::string, 4> candidate_values = {
-      "parallel_for",
-      "parallel_reduce",
-      "parallel_scan",
-      "parallel_copy",
-  };
-
-  Experimental::SetOrRange kernel_type_variable_candidates =
-      Experimental::make_candidate_set(4, candidate_values.data());
-
-  Experimental::kernel_name_context_variable_id =
-      Experimental::declare_input_type("kokkos.kernel_name", kernel_name);
-
-  Experimental::VariableInfo kernel_type;
-  kernel_type.type = Experimental::ValueType::kokkos_value_string;
-  kernel_type.category =
-      Experimental::StatisticalCategory::kokkos_value_categorical;
-  kernel_type.valueQuantity =
-      Experimental::CandidateValueType::kokkos_value_set;
-  kernel_type.candidates = kernel_type_variable_candidates;
-  Experimental::kernel_type_context_variable_id =
-      Experimental::declare_input_type("kokkos.kernel_type", kernel_type);
-
-#endif
 
   Experimental::no_profiling.init     = nullptr;
   Experimental::no_profiling.finalize = nullptr;
@@ -773,6 +808,7 @@ void initialize(const std::string& profileLibrary) {
   Experimental::no_profiling.pop_region      = nullptr;
   Experimental::no_profiling.allocate_data   = nullptr;
   Experimental::no_profiling.deallocate_data = nullptr;
+  Experimental::no_profiling.resize_scratch  = nullptr;
 
   Experimental::no_profiling.begin_deep_copy = nullptr;
   Experimental::no_profiling.end_deep_copy   = nullptr;
@@ -885,6 +921,9 @@ void set_allocate_data_callback(allocateDataFunction callback) {
 void set_deallocate_data_callback(deallocateDataFunction callback) {
   current_callbacks.deallocate_data = callback;
 }
+void set_resize_scratch_callback(resizeScratchFunction callback) {
+  current_callbacks.resize_scratch = callback;
+}
 void set_create_profile_section_callback(
     createProfileSectionFunction callback) {
   current_callbacks.create_profile_section = callback;
@@ -1094,6 +1133,14 @@ bool have_tuning_tool() {
 #endif
 }
 
+size_t get_host_serial_threshold_variable_id() {
+#ifdef KOKKOS_ENABLE_TUNING
+  return host_serial_threshold_variable_id;
+#else
+  return 0;
+#endif
+}
+
 VariableValue make_variable_value(size_t id, int64_t val) {
   VariableValue variable_value;
   variable_value.type_id         = id;
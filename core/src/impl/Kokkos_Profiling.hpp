@@ -73,6 +73,13 @@ void parse_command_line_arguments(int& narg, char* arg[],
 Kokkos::Tools::Impl::InitializationStatus parse_environment_variables(
     InitArguments& arguments);
 
+// The kernel statistics are a tool built into Kokkos, for when no tool library
+// can be loaded.  Once initialized they collect the launches and times of the
+// kernels per label, the deep copies between memory spaces and the high-water
+// mark of the memory allocated in each space, and print them at finalize.
+void initialize_kernel_statistics();
+void print_kernel_statistics(std::ostream& os);
+
 template <typename PolicyType, typename Functor>
 struct ToolResponse {
   PolicyType policy;
@@ -107,12 +114,21 @@ void allocateData(const SpaceHandle space, const std::string label,
 void deallocateData(const SpaceHandle space, const std::string label,
                     const void* ptr, const uint64_t size);
 
+/**
+ * resizeScratch declares to the tool that an execution space reallocated
+ * the scratch memory of its threads, from old_size to size bytes in total.
+ * It is called between the begin and end callbacks of the kernel that needed
+ * more scratch memory than was allocated.
+ */
+void resizeScratch(const SpaceHandle space, const uint64_t old_size,
+                   const uint64_t size);
+
 void beginDeepCopy(const SpaceHandle dst_space, const std::string dst_label,
                    const void* dst_ptr, const SpaceHandle src_space,
                    const std::string src_label, const void* src_ptr,
                    const uint64_t size);
 void endDeepCopy();
-void beginFence(const std::string name, const uint32_t deviceId,
+void beginFence(const std::string& name, const uint32_t deviceId,
                 uint64_t* handle);
 void endFence(const uint64_t handle);
 
@@ -237,6 +253,7 @@ void set_push_region_callback(pushFunction callback);
 void set_pop_region_callback(popFunction callback);
 void set_allocate_data_callback(allocateDataFunction callback);
 void set_deallocate_data_callback(deallocateDataFunction callback);
+void set_resize_scratch_callback(resizeScratchFunction callback);
 void set_create_profile_section_callback(createProfileSectionFunction callback);
 void set_start_profile_section_callback(startProfileSectionFunction callback);
 void set_stop_profile_section_callback(stopProfileSectionFunction callback);
@@ -298,6 +315,7 @@ using Kokkos::Tools::endParallelScan;
 
 using Kokkos::Tools::allocateData;
 using Kokkos::Tools::deallocateData;
+using Kokkos::Tools::resizeScratch;
 
 using Kokkos::Tools::beginDeepCopy;
 using Kokkos::Tools::endDeepCopy;
@@ -382,6 +400,10 @@ void request_output_values(size_t contextId, size_t count,
 
 bool have_tuning_tool();
 
+// The output variable through which a tool chooses the serial threshold of
+// host RangePolicy launches, see RangePolicy::set_serial_threshold
+size_t get_host_serial_threshold_variable_id();
+
 size_t get_new_context_id();
 size_t get_current_context_id();
 
@@ -74,6 +74,10 @@ typedef void (*Kokkos_Profiling_deallocateDataFunction)(
     const struct Kokkos_Profiling_SpaceHandle, const char*, const void*,
     const uint64_t);
 
+// NOLINTNEXTLINE(modernize-use-using): C compatibility
+typedef void (*Kokkos_Profiling_resizeScratchFunction)(
+    const struct Kokkos_Profiling_SpaceHandle, const uint64_t, const uint64_t);
+
 // NOLINTNEXTLINE(modernize-use-using): C compatibility
 typedef void (*Kokkos_Profiling_createProfileSectionFunction)(const char*,
                                                               uint32_t*);
@@ -256,7 +260,8 @@ struct Kokkos_Profiling_EventSet {
   Kokkos_Tools_provideToolProgrammingInterfaceFunction
       provide_tool_programming_interface;
   Kokkos_Tools_requestToolSettingsFunction request_tool_settings;
-  char profiling_padding[9 * sizeof(Kokkos_Tools_functionPointer)];
+  Kokkos_Profiling_resizeScratchFunction resize_scratch;
+  char profiling_padding[8 * sizeof(Kokkos_Tools_functionPointer)];
   Kokkos_Tools_outputTypeDeclarationFunction declare_output_type;
   Kokkos_Tools_inputTypeDeclarationFunction declare_input_type;
   Kokkos_Tools_requestValueFunction request_output_values;
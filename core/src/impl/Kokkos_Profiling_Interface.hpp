@@ -153,6 +153,7 @@ using pushFunction           = Kokkos_Profiling_pushFunction;
 using popFunction            = Kokkos_Profiling_popFunction;
 using allocateDataFunction   = Kokkos_Profiling_allocateDataFunction;
 using deallocateDataFunction = Kokkos_Profiling_deallocateDataFunction;
+using resizeScratchFunction  = Kokkos_Profiling_resizeScratchFunction;
 using createProfileSectionFunction =
     Kokkos_Profiling_createProfileSectionFunction;
 using startProfileSectionFunction =
@@ -207,6 +208,7 @@ using Kokkos::Tools::popFunction;
 using Kokkos::Tools::printHelpFunction;
 using Kokkos::Tools::profileEventFunction;
 using Kokkos::Tools::pushFunction;
+using Kokkos::Tools::resizeScratchFunction;
 using Kokkos::Tools::SpaceHandle;
 using Kokkos::Tools::startProfileSectionFunction;
 using Kokkos::Tools::stopProfileSectionFunction;
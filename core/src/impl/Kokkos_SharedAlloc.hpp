@@ -90,8 +90,8 @@ class SharedAllocationRecord<void, void> {
 
   using function_type = void (*)(SharedAllocationRecord<void, void>*);
 
-  SharedAllocationHeader* const m_alloc_ptr;
-  size_t const m_alloc_size;
+  SharedAllocationHeader* m_alloc_ptr;
+  size_t m_alloc_size;
   function_type const m_dealloc;
 #ifdef KOKKOS_ENABLE_DEBUG
   SharedAllocationRecord* const m_root;
@@ -19,6 +19,7 @@
 
 #include <impl/Kokkos_Profiling.hpp>
 #include <impl/Kokkos_FunctorAnalysis.hpp>
+#include <impl/Kokkos_HostSerialThreshold.hpp>
 
 #include <Kokkos_Core_fwd.hpp>
 #include <Kokkos_ExecPolicy.hpp>
@@ -40,6 +41,10 @@ static std::map<std::string,
                 Kokkos::Tools::Experimental::RangePolicyOccupancyTuner>
     range_policy_tuners;
 
+static std::map<std::string,
+                Kokkos::Tools::Experimental::RangePolicyChunkSizeTuner>
+    range_policy_chunk_size_tuners;
+
 template <int Rank>
 using MDRangeTuningMap =
     std::map<std::string, Kokkos::Tools::Experimental::MDRangeTuner<Rank>>;
@@ -167,13 +172,10 @@ auto generic_tune_policy(const std::string& label_in, Map& map,
                          const TagType& tag,
                          const TuningPermissionFunctor& should_tune) {
   if (should_tune(policy)) {
-    std::string label = label_in;
-    if (label_in.empty()) {
-      using policy_type = std::remove_reference_t<decltype(policy)>;
-      using work_tag    = typename policy_type::work_tag;
-      Kokkos::Impl::ParallelConstructName<Functor, work_tag> name(label);
-      label = name.get();
-    }
+    using policy_type = std::remove_reference_t<decltype(policy)>;
+    using work_tag    = typename policy_type::work_tag;
+    Kokkos::Impl::ParallelConstructName<Functor, work_tag> name(label_in);
+    const std::string& label = name.get();
     auto tuner_iter = [&]() {
       auto my_tuner = map.find(label);
       if (my_tuner == map.end()) {
@@ -194,13 +196,10 @@ auto generic_tune_policy(const std::string& label_in, Map& map,
                          const TagType& tag,
                          const TuningPermissionFunctor& should_tune) {
   if (should_tune(policy)) {
-    std::string label = label_in;
-    if (label_in.empty()) {
-      using policy_type = std::remove_reference_t<decltype(policy)>;
-      using work_tag    = typename policy_type::work_tag;
-      Kokkos::Impl::ParallelConstructName<Functor, work_tag> name(label);
-      label = name.get();
-    }
+    using policy_type = std::remove_reference_t<decltype(policy)>;
+    using work_tag    = typename policy_type::work_tag;
+    Kokkos::Impl::ParallelConstructName<Functor, work_tag> name(label_in);
+    const std::string& label = name.get();
     auto tuner_iter = [&]() {
       auto my_tuner = map.find(label);
       if (my_tuner == map.end()) {
@@ -260,13 +259,27 @@ auto tune_range_policy(const size_t tuning_context, const std::string& label_in,
   return tune_occupancy_controlled_policy(tuning_context, label_in, policy,
                                           functor, tag);
 }
+// Only the default tuner tunes the chunk size, see RangePolicyChunkSizeTuner
+template <class... Properties>
+bool should_tune_chunk_size(const Kokkos::RangePolicy<Properties...>& policy) {
+  using schedule_type =
+      typename Kokkos::RangePolicy<Properties...>::schedule_type::type;
+  return std::is_same_v<schedule_type, Kokkos::Dynamic> &&
+         policy.impl_auto_chunk_size() &&
+         Kokkos::Tools::Experimental::have_default_tuner();
+}
+
 template <class Functor, class TagType, class... Properties>
 auto tune_range_policy(const size_t /**tuning_context*/,
-                       const std::string& /*label_in*/,
+                       const std::string& label_in,
                        const Kokkos::RangePolicy<Properties...>& policy,
-                       const Functor& /**functor*/, const TagType& /**tag*/,
+                       const Functor& functor, const TagType& tag,
                        std::false_type) {
-  return policy;
+  return generic_tune_policy<Experimental::RangePolicyChunkSizeTuner>(
+      label_in, range_policy_chunk_size_tuners, policy, functor, tag,
+      [](const Kokkos::RangePolicy<Properties...>& candidate_policy) {
+        return should_tune_chunk_size(candidate_policy);
+      });
 }
 
 // Reducer versions
@@ -291,10 +304,56 @@ auto tune_range_policy(const size_t tuning_context, const std::string& label_in,
 }
 template <class ReducerType, class Functor, class TagType, class... Properties>
 auto tune_range_policy(const size_t /**tuning_context*/,
-                       const std::string& /**label_in*/,
+                       const std::string& label_in,
                        const Kokkos::RangePolicy<Properties...>& policy,
-                       const Functor& /**functor*/, const TagType& /**tag*/,
+                       const Functor& functor, const TagType& tag,
                        std::false_type) {
+  return generic_tune_policy<Experimental::RangePolicyChunkSizeTuner>(
+      label_in, range_policy_chunk_size_tuners, policy, functor, tag,
+      [](const Kokkos::RangePolicy<Properties...>& candidate_policy) {
+        return should_tune_chunk_size(candidate_policy);
+      });
+}
+
+// Host RangePolicies learn per label the length below which they run
+// serially, unless the user set a serial threshold.  A tuning tool chooses
+// the threshold instead, through the kokkos.host_serial_threshold output
+// variable of the launch's context.
+template <class Functor, class... Properties>
+auto tune_serial_threshold(const size_t tuning_context,
+                           const std::string& label_in,
+                           Kokkos::RangePolicy<Properties...> policy,
+                           const Functor&) {
+  using policy_t = Kokkos::RangePolicy<Properties...>;
+  if constexpr (std::is_same_v<
+                    typename policy_t::execution_space::memory_space,
+                    Kokkos::HostSpace>) {
+    if (policy.serial_threshold() < 0 &&
+        Kokkos::Tools::Experimental::have_tuning_tool()) {
+      // 0, always using the pool, unless the tool chooses otherwise
+      auto threshold = Kokkos::Tools::Experimental::make_variable_value(
+          Kokkos::Tools::Experimental::get_host_serial_threshold_variable_id(),
+          int64_t(0));
+      Kokkos::Tools::Experimental::request_output_values(tuning_context, 1,
+                                                         &threshold);
+      policy.set_serial_threshold(
+          std::max<int64_t>(threshold.value.int_value, 0));
+    }
+    if (policy.serial_threshold() < 0) {
+      Kokkos::Impl::ParallelConstructName<Functor, typename policy_t::work_tag>
+          name(label_in);
+      // The threshold of the last label launched with this functor type is
+      // kept by each thread, so that launching the same kernel again neither
+      // locks nor looks its label up
+      thread_local std::string cached_label;
+      thread_local Kokkos::Impl::HostSerialThreshold* cached_state = nullptr;
+      if (cached_state == nullptr || cached_label != name.get()) {
+        cached_state = &Kokkos::Impl::get_host_serial_threshold(name.get());
+        cached_label = name.get();
+      }
+      policy.impl_set_serial_threshold_state(cached_state);
+    }
+  }
   return policy;
 }
 
@@ -307,8 +366,11 @@ auto tune_policy(const size_t tuning_context, const std::string& label_in,
   using has_desired_occupancy =
       typename std::is_same<typename policy_t::occupancy_control,
                             Kokkos::Experimental::DesiredOccupancy>::type;
-  return tune_range_policy(tuning_context, label_in, policy, functor, tag,
-                           has_desired_occupancy{});
+  return tune_serial_threshold(
+      tuning_context, label_in,
+      tune_range_policy(tuning_context, label_in, policy, functor, tag,
+                        has_desired_occupancy{}),
+      functor);
 }
 
 // tune a RangePolicy, with reducer
@@ -320,8 +382,11 @@ auto tune_policy(const size_t tuning_context, const std::string& label_in,
   using has_desired_occupancy =
       typename std::is_same<typename policy_t::occupancy_control,
                             Kokkos::Experimental::DesiredOccupancy>::type;
-  return tune_range_policy<ReducerType>(tuning_context, label_in, policy,
-                                        functor, tag, has_desired_occupancy{});
+  return tune_serial_threshold(
+      tuning_context, label_in,
+      tune_range_policy<ReducerType>(tuning_context, label_in, policy,
+                                     functor, tag, has_desired_occupancy{}),
+      functor);
 }
 
 // tune a MDRangePolicy, without reducer
@@ -386,15 +451,18 @@ void generic_report_results(const std::string& label_in, Map& map,
                             const TagType&,
                             const TuningPermissionFunctor& should_tune) {
   if (should_tune(policy)) {
-    std::string label = label_in;
-    if (label_in.empty()) {
-      using policy_type = std::remove_reference_t<decltype(policy)>;
-      using work_tag    = typename policy_type::work_tag;
-      Kokkos::Impl::ParallelConstructName<Functor, work_tag> name(label);
-      label = name.get();
+    using policy_type = std::remove_reference_t<decltype(policy)>;
+    using work_tag    = typename policy_type::work_tag;
+    Kokkos::Impl::ParallelConstructName<Functor, work_tag> name(label_in);
+    const std::string& label = name.get();
+    auto& tuner = map[label];
+    // the default tuner times the kernel, so it has to be complete
+    if (tuner.impl_default_tuner_measuring()) {
+      policy.space().fence(
+          "Kokkos::Tools::Experimental::Impl::generic_report_results: "
+          "default tuner measurement");
     }
-    auto tuner_iter = map[label];
-    tuner_iter.end();
+    tuner.end();
   }
 }
 
@@ -432,18 +500,24 @@ void report_policy_results(const size_t /**tuning_context*/,
       });
 }
 
-// report results for an MDRangePolicy
+// report results for a RangePolicy
 template <class Functor, class TagType, class... Properties>
 void report_policy_results(const size_t /**tuning_context*/,
                            const std::string& label_in,
                            const Kokkos::RangePolicy<Properties...>& policy,
                            const Functor& functor, const TagType& tag) {
   using Policy = Kokkos::RangePolicy<Properties...>;
-  generic_report_results<Experimental::RangePolicyOccupancyTuner>(
-      label_in, range_policy_tuners, policy, functor, tag, [](const Policy&) {
-        return Kokkos::RangePolicy<
-            Properties...>::traits::experimental_contains_desired_occupancy;
-      });
+  if constexpr (Policy::traits::experimental_contains_desired_occupancy) {
+    generic_report_results<Experimental::RangePolicyOccupancyTuner>(
+        label_in, range_policy_tuners, policy, functor, tag,
+        [](const Policy&) { return true; });
+  } else {
+    generic_report_results<Experimental::RangePolicyChunkSizeTuner>(
+        label_in, range_policy_chunk_size_tuners, policy, functor, tag,
+        [](const Policy& candidate_policy) {
+          return should_tune_chunk_size(candidate_policy);
+        });
+  }
 }
 
 }  // namespace Impl
@@ -0,0 +1,82 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_KOKKOS_REPRODUCIBLETRAIT_HPP
+#define KOKKOS_KOKKOS_REPRODUCIBLETRAIT_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Concepts.hpp>  // Experimental::Reproducible
+#include <traits/Kokkos_PolicyTraitAdaptor.hpp>
+#include <traits/Kokkos_Traits_fwd.hpp>
+#include <impl/Kokkos_Utilities.hpp>  // is_specialization_of
+
+#include <type_traits>
+
+namespace Kokkos {
+
+template <class... Properties>
+class RangePolicy;
+
+namespace Impl {
+
+//==============================================================================
+// <editor-fold desc="trait specification"> {{{1
+
+struct ReproducibleTrait : TraitSpecificationBase<ReproducibleTrait> {
+  struct base_traits {
+    using is_reproducible = std::false_type;
+    KOKKOS_IMPL_MSVC_NVCC_EBO_WORKAROUND
+  };
+  template <class, class AnalyzeNextTrait>
+  struct mixin_matching_trait : AnalyzeNextTrait {
+    using base_t = AnalyzeNextTrait;
+    using base_t::base_t;
+    using is_reproducible = std::true_type;
+  };
+  template <class T>
+  using trait_matches_specification =
+      std::is_same<T, Kokkos::Experimental::Reproducible>;
+};
+
+// </editor-fold> end trait specification }}}1
+//==============================================================================
+
+//==============================================================================
+// <editor-fold desc="supported policies"> {{{1
+
+// Specialized to std::true_type by the backends whose RangePolicy reductions
+// honor Experimental::Reproducible
+template <class ExecutionSpace>
+struct SupportsReproducibleReduce : std::false_type {};
+
+// The trait is only honored by RangePolicy reductions on the backends above,
+// any other use is rejected at compile time rather than silently ignored.
+// std::disjunction only instantiates SupportsReproducibleReduce for policies
+// with the trait, before the backends have specialized it.
+template <class Policy>
+inline constexpr bool reproducible_reduce_is_supported_v = std::disjunction_v<
+    std::negation<typename Policy::is_reproducible>,
+    std::conjunction<
+        is_specialization_of<Policy, Kokkos::RangePolicy>,
+        SupportsReproducibleReduce<typename Policy::execution_space>>>;
+
+// </editor-fold> end supported policies }}}1
+//==============================================================================
+
+}  // end namespace Impl
+}  // end namespace Kokkos
+
+#endif  // KOKKOS_KOKKOS_REPRODUCIBLETRAIT_HPP
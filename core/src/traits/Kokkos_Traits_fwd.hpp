@@ -65,6 +65,8 @@ struct WorkItemPropertyTrait;
 struct LaunchBoundsTrait;
 struct OccupancyControlTrait;
 struct GraphKernelTrait;
+struct ReproducibleTrait;
+struct ElementwiseTrait;
 struct WorkTagTrait;
 
 // Keep these sorted by frequency of use to reduce compilation time
@@ -80,6 +82,8 @@ using execution_policy_trait_specifications =
     LaunchBoundsTrait,
     OccupancyControlTrait,
     GraphKernelTrait,
+    ReproducibleTrait,
+    ElementwiseTrait,
     // This one has to be last, unfortunately:
     WorkTagTrait
   >;
@@ -519,6 +519,63 @@ TEST(TEST_CATEGORY, atomics) {
 #endif
 }
 
+// A 16-byte value whose halves are always updated together, so that a torn
+// atomic operation shows up as different halves
+struct alignas(16) TwoCounters {
+  int64_t first;
+  int64_t second;
+
+  KOKKOS_FUNCTION TwoCounters operator+(TwoCounters const& rhs) const {
+    return {first + rhs.first, second + rhs.second};
+  }
+  KOKKOS_FUNCTION bool operator==(TwoCounters const& rhs) const {
+    return first == rhs.first && second == rhs.second;
+  }
+  KOKKOS_FUNCTION bool operator!=(TwoCounters const& rhs) const {
+    return !(*this == rhs);
+  }
+};
+
+struct TwoCountersUseCase {
+  Kokkos::View<TwoCounters, TEST_EXECSPACE> counters{"counters"};
+  Kokkos::View<TwoCounters, TEST_EXECSPACE> exchanged{"exchanged"};
+  Kokkos::View<int, TEST_EXECSPACE> torn{"torn"};
+
+  KOKKOS_FUNCTION void operator()(int i) const {
+    Kokkos::atomic_add(&counters(), TwoCounters{1, 1});
+
+    TwoCounters old = Kokkos::atomic_load(&counters());
+    TwoCounters assumed;
+    do {
+      assumed = old;
+      old     = Kokkos::atomic_compare_exchange(&counters(), assumed,
+                                                assumed + TwoCounters{1, 1});
+    } while (old != assumed);
+
+    TwoCounters previous = Kokkos::atomic_exchange(&exchanged(), {i, i});
+    if (old.first != old.second || previous.first != previous.second) {
+      Kokkos::atomic_inc(&torn());
+    }
+  }
+
+  void check(int n) {
+    Kokkos::parallel_for(Kokkos::RangePolicy<TEST_EXECSPACE>(0, n), *this);
+    TwoCounters result;
+    int num_torn;
+    Kokkos::deep_copy(result, counters);
+    Kokkos::deep_copy(num_torn, torn);
+    ASSERT_EQ(result.first, 2 * n);
+    ASSERT_EQ(result.second, 2 * n);
+    ASSERT_EQ(num_torn, 0);
+  }
+};
+
+// FIXME_OPENMPTARGET FIXME_OPENACC: atomic operations on composite types are
+// not supported.
+#if !defined(KOKKOS_ENABLE_OPENMPTARGET) && !defined(KOKKOS_ENABLE_OPENACC)
+TEST(TEST_CATEGORY, atomics_16byte) { TwoCountersUseCase().check(10000); }
+#endif
+
 // see https://github.com/trilinos/Trilinos/pull/11506
 struct TpetraUseCase {
   template <class Scalar>
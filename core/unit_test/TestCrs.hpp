@@ -14,6 +14,7 @@
 //
 //@HEADER
 
+#include <algorithm>
 #include <vector>
 
 #include <Kokkos_Core.hpp>
@@ -171,6 +172,61 @@ void test_constructor(std::int32_t nrows) {
   }
 }
 
+// Row i has entries (i * 7 + k * 13) % nrows for k < i % degree
+template <class ExecSpace>
+struct TransposeFillFunctor {
+  std::int32_t nrows;
+  std::int32_t degree;
+  KOKKOS_INLINE_FUNCTION
+  std::int32_t operator()(std::int32_t row, std::int32_t *fill) const {
+    auto n = row % degree;
+    if (fill) {
+      for (std::int32_t k = 0; k < n; ++k) {
+        fill[k] = (row * 7 + k * 13) % nrows;
+      }
+    }
+    return n;
+  }
+};
+
+template <class ExecSpace>
+void test_transpose(std::int32_t nrows, std::int32_t degree) {
+  using crs_type = Kokkos::Crs<std::int32_t, ExecSpace, void, std::int32_t>;
+  crs_type graph;
+  Kokkos::count_and_fill_crs(graph, nrows,
+                             TransposeFillFunctor<ExecSpace>{nrows, degree});
+  crs_type transpose;
+  Kokkos::transpose_crs(transpose, graph);
+  ASSERT_EQ(transpose.numRows(), nrows);
+
+  std::vector<std::vector<std::int32_t>> expected(nrows);
+  for (std::int32_t row = 0; row < nrows; ++row) {
+    for (std::int32_t k = 0; k < row % degree; ++k) {
+      expected[(row * 7 + k * 13) % nrows].push_back(row);
+    }
+  }
+  auto row_map = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     transpose.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                     transpose.entries);
+  for (std::int32_t row = 0; row < nrows; ++row) {
+    ASSERT_EQ(row_map(row + 1) - row_map(row),
+              std::int32_t(expected[row].size()));
+    std::vector<std::int32_t> found(entries.data() + row_map(row),
+                                    entries.data() + row_map(row + 1));
+    std::sort(found.begin(), found.end());
+    ASSERT_EQ(found, expected[row]) << "row " << row;
+  }
+
+  Kokkos::View<std::int32_t *, ExecSpace> counts;
+  Kokkos::get_crs_transpose_counts(counts, graph);
+  auto h_counts =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), counts);
+  for (std::int32_t row = 0; row < nrows; ++row) {
+    ASSERT_EQ(h_counts(row), std::int32_t(expected[row].size()));
+  }
+}
+
 }  // anonymous namespace
 
 TEST(TEST_CATEGORY, crs_count_fill) {
@@ -184,6 +240,16 @@ TEST(TEST_CATEGORY, crs_count_fill) {
   test_count_fill<TEST_EXECSPACE>(10000);
 }
 
+TEST(TEST_CATEGORY, crs_transpose) {
+  test_transpose<TEST_EXECSPACE>(0, 1);
+  test_transpose<TEST_EXECSPACE>(1, 3);
+  test_transpose<TEST_EXECSPACE>(13, 3);
+  // fewer entries than rows
+  test_transpose<TEST_EXECSPACE>(1000, 2);
+  test_transpose<TEST_EXECSPACE>(1000, 64);
+  test_transpose<TEST_EXECSPACE>(10000, 17);
+}
+
 TEST(TEST_CATEGORY, crs_copy_constructor) {
   test_constructor<TEST_EXECSPACE>(0);
   test_constructor<TEST_EXECSPACE>(1);
@@ -498,6 +498,302 @@ TEST_F(TEST_CATEGORY_FIXTURE(graph), diamond) {
   ASSERT_EQ(data_host(index_D()), 2 * value_A + value_B + value_C + value_D);
 }
 
+template <typename ViewType>
+struct SumEntries {
+  ViewType data;
+  int target;
+  int first;
+  int last;
+  int value;
+
+  template <typename T>
+  KOKKOS_FUNCTION void operator()(const T) const {
+    typename ViewType::value_type sum = value;
+    for (int i = first; i < last; ++i) sum += data(i);
+    data(target) = sum;
+  }
+};
+
+// Ensure that independent branches on several execution space instances are
+// all executed before the node joining them, on every submission.
+//
+// topology
+//
+//  A0  A1  A2  A3      A0(exec_0)  A1(exec_1)  A2(exec_0)  A3(exec_1)
+//  |   |   |   |
+//  B0  B1  B2  B3      B0(exec_0)  B1(exec_1)  B2(exec_0)  B3(exec_1)
+//   \   \  /   /
+//        C             C(exec_0)
+TEST_F(TEST_CATEGORY_FIXTURE(graph), independent_branches) {
+  const auto execution_space_instances =
+      Kokkos::Experimental::partition_space(ex, 1, 1);
+
+  using policy_t  = Kokkos::RangePolicy<TEST_EXECSPACE>;
+  using view_t    = Kokkos::View<int*, TEST_EXECSPACE>;
+  using functor_t = SumEntries<view_t>;
+
+  constexpr int num_branches = 4;
+  view_t data(Kokkos::view_alloc(ex, "independent branches - data"),
+              2 * num_branches + 1);
+
+  auto graph = Kokkos::Experimental::create_graph(ex, [&](auto root) {
+    auto branch = [&](int i) {
+      const auto exec = execution_space_instances.at(i % 2);
+      return root
+          .then_parallel_for(policy_t(exec, 0, 1),
+                             functor_t{data, i, 0, 0, i + 1})
+          .then_parallel_for(
+              policy_t(exec, 0, 1),
+              functor_t{data, num_branches + i, i, i + 1, 10 * (i + 1)});
+    };
+    Kokkos::Experimental::when_all(branch(0), branch(1), branch(2), branch(3))
+        .then_parallel_for(policy_t(execution_space_instances.at(0), 0, 1),
+                           functor_t{data, 2 * num_branches, num_branches,
+                                     2 * num_branches, 0});
+  });
+  graph.instantiate();
+
+  for (int submission = 0; submission < 3; ++submission) {
+    Kokkos::deep_copy(ex, data, 0);
+    graph.submit(ex);
+
+    auto data_host = Kokkos::create_mirror_view(data);
+    Kokkos::deep_copy(ex, data_host, data);
+    ex.fence();
+
+    int expected_sum = 0;
+    for (int i = 0; i < num_branches; ++i) {
+      ASSERT_EQ(data_host(i), i + 1);
+      ASSERT_EQ(data_host(num_branches + i), 11 * (i + 1));
+      expected_sum += 11 * (i + 1);
+    }
+    ASSERT_EQ(data_host(2 * num_branches), expected_sum);
+  }
+}
+
+// Ensure that the sinks running on the instance of the graph are waited for
+// when the graph is submitted onto another instance.
+//
+// topology
+//
+//  A      A(exec_0) fills the View
+//  |
+//  B      B(exec_0) increments every entry
+TEST_F(TEST_CATEGORY_FIXTURE(graph), submit_onto_another_instance_with_sink) {
+  const auto execution_space_instances =
+      Kokkos::Experimental::partition_space(ex, 1, 1);
+  const auto exec_0 = execution_space_instances.at(0);
+  const auto exec_1 = execution_space_instances.at(1);
+
+  using policy_t = Kokkos::RangePolicy<TEST_EXECSPACE>;
+  using view_t   = Kokkos::View<int*, TEST_EXECSPACE>;
+
+  constexpr int n = 1 << 20;
+  view_t data(Kokkos::view_alloc(exec_0, "sink on graph instance - data"), n);
+
+  auto graph = Kokkos::Experimental::create_graph(exec_0, [&](auto root) {
+    root.then_parallel_for(policy_t(exec_0, 0, n),
+                           KOKKOS_LAMBDA(const int i) { data(i) = i % 7; })
+        .then_parallel_for(policy_t(exec_0, 0, n),
+                           KOKKOS_LAMBDA(const int i) { data(i) += 1; });
+  });
+  graph.instantiate();
+  exec_0.fence();
+
+  for (int submission = 0; submission < 3; ++submission) {
+    graph.submit(exec_1);
+
+    auto data_host = Kokkos::create_mirror_view(data);
+    Kokkos::deep_copy(exec_1, data_host, data);
+    exec_1.fence();
+
+    for (int i = 0; i < n; ++i) ASSERT_EQ(data_host(i), i % 7 + 1);
+  }
+}
+
+template <typename ViewType>
+struct AxpyEntries {
+  ViewType x;
+  ViewType y;
+  typename ViewType::value_type a;
+
+  struct TagScale {};
+
+  KOKKOS_FUNCTION void operator()(const int i) const { y(i) += a * x(i); }
+  KOKKOS_FUNCTION void operator()(TagScale, const int i) const { y(i) *= a; }
+};
+
+// Ensure that chains of elementwise nodes compute the same result as unfused
+// nodes, including when the chain is broken by a node with several
+// successors or by different bounds.
+//
+// topology
+//
+//   A          x = i, y = 0       elementwise over [0, n)
+//   |
+//   B          y += 2 x           elementwise over [0, n)
+//   |
+//   C          y *= 3             elementwise over [0, n), tagged
+//  / \         C has two successors, ending the chain
+// D   E        D: x += y          elementwise over [0, n / 2)
+//              E: y[n] = sum(y)
+TEST_F(TEST_CATEGORY_FIXTURE(graph), elementwise_chain) {
+  using view_t    = Kokkos::View<long*, TEST_EXECSPACE>;
+  using functor_t = AxpyEntries<view_t>;
+  using elementwise_policy_t =
+      Kokkos::RangePolicy<TEST_EXECSPACE, Kokkos::Experimental::Elementwise>;
+  using tagged_policy_t =
+      Kokkos::RangePolicy<TEST_EXECSPACE, Kokkos::Experimental::Elementwise,
+                          typename functor_t::TagScale>;
+
+  static_assert(elementwise_policy_t::is_elementwise::value);
+  static_assert(!Kokkos::RangePolicy<TEST_EXECSPACE>::is_elementwise::value);
+
+  constexpr int n = 10000;
+  view_t x(Kokkos::view_alloc(ex, "elementwise chain - x"), n);
+  view_t y(Kokkos::view_alloc(ex, "elementwise chain - y"), n + 1);
+
+  auto graph = Kokkos::Experimental::create_graph(ex, [&](auto root) {
+    auto node_A = root.then_parallel_for(
+        elementwise_policy_t(ex, 0, n), KOKKOS_LAMBDA(const int i) {
+          x(i) = i;
+          y(i) = 0;
+        });
+    auto node_B = node_A.then_parallel_for(elementwise_policy_t(ex, 0, n),
+                                           functor_t{x, y, 2});
+    auto node_C = node_B.then_parallel_for(tagged_policy_t(ex, 0, n),
+                                           functor_t{x, y, 3});
+    node_C.then_parallel_for(elementwise_policy_t(ex, 0, n / 2),
+                             functor_t{y, x, 1});
+    node_C.then_parallel_for(
+        Kokkos::RangePolicy<TEST_EXECSPACE>(ex, 0, 1), KOKKOS_LAMBDA(int) {
+          long sum = 0;
+          for (int i = 0; i < n; ++i) sum += y(i);
+          y(n) = sum;
+        });
+  });
+  graph.instantiate();
+
+  for (int submission = 0; submission < 2; ++submission) {
+    graph.submit(ex);
+
+    auto x_host = Kokkos::create_mirror_view(x);
+    auto y_host = Kokkos::create_mirror_view(y);
+    Kokkos::deep_copy(ex, x_host, x);
+    Kokkos::deep_copy(ex, y_host, y);
+    ex.fence();
+
+    long sum = 0;
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(x_host(i), i < n / 2 ? 7l * i : long(i));
+      ASSERT_EQ(y_host(i), 6l * i);
+      sum += 6l * i;
+    }
+    ASSERT_EQ(y_host(n), sum);
+  }
+}
+
+// Ensure that a chain of fused kernels submitted onto an instance completes
+// correctly when the graph is destroyed before the instance is fenced.
+TEST_F(TEST_CATEGORY_FIXTURE(graph), elementwise_chain_outlives_graph) {
+  using view_t    = Kokkos::View<long*, TEST_EXECSPACE>;
+  using functor_t = AxpyEntries<view_t>;
+  using elementwise_policy_t =
+      Kokkos::RangePolicy<TEST_EXECSPACE, Kokkos::Experimental::Elementwise>;
+
+  constexpr int n = 1 << 20;
+  view_t x(Kokkos::view_alloc(ex, "elementwise chain - x"), n);
+  view_t y(Kokkos::view_alloc(ex, "elementwise chain - y"), n);
+  Kokkos::deep_copy(ex, x, 1);
+
+  {
+    auto graph = Kokkos::Experimental::create_graph(ex, [&](auto root) {
+      root.then_parallel_for(elementwise_policy_t(ex, 0, n), functor_t{x, y, 2})
+          .then_parallel_for(elementwise_policy_t(ex, 0, n),
+                             functor_t{x, y, 3});
+    });
+    graph.submit(ex);
+  }
+
+  auto y_host = Kokkos::create_mirror_view(y);
+  Kokkos::deep_copy(ex, y_host, y);
+  ex.fence();
+  for (int i = 0; i < n; ++i) ASSERT_EQ(y_host(i), 5l);
+}
+
+template <typename ViewType>
+struct ReduceEntries {
+  ViewType data;
+
+  KOKKOS_FUNCTION void operator()(const int i,
+                                  typename ViewType::value_type& sum) const {
+    sum += data(i);
+  }
+};
+
+template <typename Exec>
+void test_graph_capture(const Exec& ex) {
+  if constexpr (!Kokkos::Impl::is_graph_capturable_v<Exec>) {
+    GTEST_SKIP() << "only host execution spaces can be captured";
+  } else {
+    using view_t    = Kokkos::View<long*, Exec>;
+    using functor_t = AxpyEntries<view_t>;
+    using elementwise_policy_t =
+        Kokkos::RangePolicy<Exec, Kokkos::Experimental::Elementwise>;
+    using tagged_policy_t =
+        Kokkos::RangePolicy<Exec, Kokkos::Experimental::Elementwise,
+                            typename functor_t::TagScale>;
+
+    constexpr int n = 1000;
+    view_t x(Kokkos::view_alloc(ex, "capture - x"), n);
+    view_t y(Kokkos::view_alloc(ex, "capture - y"), n);
+    Kokkos::View<long, Exec> sum(Kokkos::view_alloc(ex, "capture - sum"));
+    ex.fence();
+
+    Kokkos::Experimental::begin_capture(ex);
+    ASSERT_THROW(Kokkos::Experimental::begin_capture(ex), std::runtime_error);
+    Kokkos::deep_copy(ex, x, 1);
+    Kokkos::deep_copy(ex, y, 0);
+    Kokkos::parallel_for(elementwise_policy_t(ex, 0, n), functor_t{x, y, 2});
+    Kokkos::parallel_for(tagged_policy_t(ex, 0, n), functor_t{x, y, 3});
+    ex.fence();
+    Kokkos::parallel_reduce(Kokkos::RangePolicy<Exec>(ex, 0, n),
+                            ReduceEntries<view_t>{y}, sum);
+    long scalar = 0;
+    ASSERT_THROW(Kokkos::parallel_reduce(Kokkos::RangePolicy<Exec>(ex, 0, n),
+                                         ReduceEntries<view_t>{y}, scalar),
+                 std::runtime_error);
+    ASSERT_THROW(Kokkos::deep_copy(ex, scalar, sum), std::runtime_error);
+    // Copies without an instance would run before the captured operations
+    ASSERT_THROW(Kokkos::deep_copy(scalar, sum), std::runtime_error);
+    ASSERT_THROW(Kokkos::deep_copy(sum, 1l), std::runtime_error);
+    ASSERT_THROW(Kokkos::deep_copy(x, 2), std::runtime_error);
+    ASSERT_THROW(Kokkos::deep_copy(x, y), std::runtime_error);
+    auto graph = Kokkos::Experimental::end_capture(ex);
+    ASSERT_THROW((void)Kokkos::Experimental::end_capture(ex),
+                 std::runtime_error);
+
+    // Nothing was executed while capturing
+    ASSERT_TRUE(contains(ex, sum, 0l));
+
+    for (int submission = 0; submission < 2; ++submission) {
+      Kokkos::deep_copy(ex, sum, -1l);
+      graph.submit(ex);
+
+      auto y_host = Kokkos::create_mirror_view(y);
+      Kokkos::deep_copy(ex, y_host, y);
+      ASSERT_TRUE(contains(ex, sum, 6l * n));
+      for (int i = 0; i < n; ++i) ASSERT_EQ(y_host(i), 6l);
+    }
+  }
+}
+
+// Ensure that the kernels, deep copies and fences issued on a captured
+// instance are replayed in order by the graph, and only by the graph.
+TEST_F(TEST_CATEGORY_FIXTURE(graph), capture) {
+  test_graph_capture(ex);
+}
+
 // Test a configuration that has more than one end node. Ensure that we wait for
 // them all by adding a manual kernel after the graph.
 // This test mainly is there to ensure that the defaulted graph implementation
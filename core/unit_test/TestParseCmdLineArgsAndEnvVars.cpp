@@ -192,6 +192,30 @@ TEST(defaultdevicetype, cmd_line_args_tune_internals) {
   EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {});
 }
 
+TEST(defaultdevicetype, cmd_line_args_tuning_cache) {
+  CmdLineArgsHelper cla = {{
+      "--kokkos-tuning-cache=my_tuning_cache.txt",
+      "--kokkos-tune-internals",
+  }};
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_command_line_arguments(cla.argc(), cla.argv(), settings);
+  EXPECT_TRUE(settings.has_tuning_cache());
+  EXPECT_EQ(settings.get_tuning_cache(), "my_tuning_cache.txt");
+  EXPECT_TRUE(settings.has_tune_internals());
+  EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {});
+}
+
+TEST(defaultdevicetype, cmd_line_args_kernel_statistics) {
+  CmdLineArgsHelper cla = {{
+      "--kokkos-kernel-statistics",
+  }};
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_command_line_arguments(cla.argc(), cla.argv(), settings);
+  EXPECT_TRUE(settings.has_kernel_statistics());
+  EXPECT_TRUE(settings.get_kernel_statistics());
+  EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {});
+}
+
 TEST(defaultdevicetype, cmd_line_args_help) {
   CmdLineArgsHelper cla = {{
       "--help",
@@ -389,6 +413,28 @@ TEST(defaultdevicetype, env_vars_tune_internals) {
   }
 }
 
+TEST(defaultdevicetype, env_vars_tuning_cache) {
+  EnvVarsHelper ev = {{
+      {"KOKKOS_TUNING_CACHE", "my_tuning_cache.txt"},
+  }};
+  SKIP_IF_ENVIRONMENT_VARIABLE_ALREADY_SET(ev);
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_environment_variables(settings);
+  EXPECT_TRUE(settings.has_tuning_cache());
+  EXPECT_EQ(settings.get_tuning_cache(), "my_tuning_cache.txt");
+}
+
+TEST(defaultdevicetype, env_vars_kernel_statistics) {
+  EnvVarsHelper ev = {{
+      {"KOKKOS_KERNEL_STATISTICS", "yes"},
+  }};
+  SKIP_IF_ENVIRONMENT_VARIABLE_ALREADY_SET(ev);
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_environment_variables(settings);
+  EXPECT_TRUE(settings.has_kernel_statistics());
+  EXPECT_TRUE(settings.get_kernel_statistics());
+}
+
 TEST(defaultdevicetype, visible_devices) {
 #define KOKKOS_TEST_VISIBLE_DEVICES(ENV, CNT, DEV)                      \
   do {                                                                  \
@@ -651,4 +651,106 @@ TEST(TEST_CATEGORY, reduction_with_large_iteration_count) {
 }
 #endif
 
+// Array reduction relying on the default init and join, with enough values
+// for host backends to join the per-thread results in parallel
+struct FunctorArrayReductionDefaultJoin {
+  using value_type = int64_t[];
+  const unsigned value_count;
+
+  KOKKOS_FUNCTION void operator()(const int i, int64_t update[]) const {
+    update[i % value_count] += i;
+  }
+};
+
+TEST(TEST_CATEGORY, array_reduction_default_join_large_count) {
+  if constexpr (!std::is_same_v<typename TEST_EXECSPACE::memory_space,
+                                Kokkos::HostSpace>) {
+    GTEST_SKIP() << "Large array reductions are only tested on host backends";
+  }
+
+  const int N = 100000;
+  for (unsigned count : {1u, 1000u, 10000u, 40000u}) {
+    Kokkos::View<int64_t*, TEST_EXECSPACE> result("result", count);
+    Kokkos::parallel_reduce("array_reduction_default_join",
+                            Kokkos::RangePolicy<TEST_EXECSPACE>(0, N),
+                            FunctorArrayReductionDefaultJoin{count}, result);
+    auto host_result =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), result);
+    for (unsigned j = 0; j < count; ++j) {
+      // sum of the indices i < N with i % count == j
+      const int64_t terms = (N - 1 - j) / count + 1;
+      ASSERT_EQ(host_result(j), terms * j + count * terms * (terms - 1) / 2);
+    }
+  }
+}
+
+// Sum with heavy cancellation, such that the result depends on the order in
+// which the iterations are combined
+struct FunctorReproducibleSum {
+  KOKKOS_FUNCTION void operator()(const int i, double& update) const {
+    update += (i % 2 ? 1.0 : -1.0) * (1.0 + i % 1000) * (i % 7 ? 1e-8 : 1e8);
+  }
+};
+
+template <class ExecSpace, class Schedule>
+double reproducible_sum(const ExecSpace& exec, const int n,
+                        const int chunk_size = 0) {
+  Kokkos::RangePolicy<ExecSpace, Schedule, Kokkos::Experimental::Reproducible>
+      policy(exec, 0, n);
+  if (chunk_size > 0) policy.set_chunk_size(chunk_size);
+  double sum = 0.0;
+  Kokkos::parallel_reduce("reproducible_sum", policy, FunctorReproducibleSum(),
+                          sum);
+  return sum;
+}
+
+// Other policies and backends reject the trait at compile time
+static_assert(!Kokkos::Impl::reproducible_reduce_is_supported_v<
+              Kokkos::MDRangePolicy<TEST_EXECSPACE, Kokkos::Rank<2>,
+                                    Kokkos::Experimental::Reproducible>>);
+static_assert(!Kokkos::Impl::reproducible_reduce_is_supported_v<
+              Kokkos::TeamPolicy<TEST_EXECSPACE,
+                                 Kokkos::Experimental::Reproducible>>);
+static_assert(Kokkos::Impl::reproducible_reduce_is_supported_v<
+              Kokkos::RangePolicy<TEST_EXECSPACE>>);
+
+template <class ExecSpace>
+void test_reduce_reproducible() {
+  using Static  = Kokkos::Schedule<Kokkos::Static>;
+  using Dynamic = Kokkos::Schedule<Kokkos::Dynamic>;
+
+  ExecSpace exec;
+  // instances using a subset of the threads
+  std::vector<ExecSpace> instances{exec, exec};
+  if (exec.concurrency() > 1) {
+    instances = Kokkos::Experimental::partition_space(exec, 1, 1);
+  }
+
+  for (int n : {0, 1, 1000, 1000000}) {
+    for (int chunk_size : {0, 1, 5000}) {
+      const double sum =
+          reproducible_sum<ExecSpace, Static>(exec, n, chunk_size);
+      ASSERT_EQ(sum,
+                (reproducible_sum<ExecSpace, Dynamic>(exec, n, chunk_size)));
+      ASSERT_EQ(sum, (reproducible_sum<ExecSpace, Static>(instances[0], n,
+                                                          chunk_size)));
+      ASSERT_EQ(sum, (reproducible_sum<ExecSpace, Dynamic>(instances[1], n,
+                                                           chunk_size)));
+#ifdef KOKKOS_ENABLE_SERIAL
+      ASSERT_EQ(sum, (reproducible_sum<Kokkos::Serial, Static>(
+                         Kokkos::Serial(), n, chunk_size)));
+#endif
+    }
+  }
+}
+
+TEST(TEST_CATEGORY, reduce_reproducible) {
+  if constexpr (!Kokkos::Impl::SupportsReproducibleReduce<
+                    TEST_EXECSPACE>::value) {
+    GTEST_SKIP() << "Reproducible trait is only honored by host backends";
+  } else {
+    test_reduce_reproducible<TEST_EXECSPACE>();
+  }
+}
+
 }  // namespace Test
@@ -202,6 +202,72 @@ TEST(TEST_CATEGORY, view_copy_tests_rank_0) {
   }
 }
 
+TEST(TEST_CATEGORY, view_copy_layout_conversion) {
+  // Extents are not multiples of the tiles used by the host transpose
+  const int n0 = 67, n1 = 131, n2 = 5;
+
+  Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace> h_r2("h_r2",
+                                                                       n0, n1);
+  Kokkos::View<int***, Kokkos::LayoutLeft, Kokkos::HostSpace> h_l3("h_l3", n0,
+                                                                   n2, n1);
+  for (int i0 = 0; i0 < n0; ++i0) {
+    for (int i1 = 0; i1 < n1; ++i1) {
+      h_r2(i0, i1) = i0 * n1 + i1;
+      for (int i2 = 0; i2 < n2; ++i2) {
+        h_l3(i0, i2, i1) = (i0 * n2 + i2) * n1 + i1;
+      }
+    }
+  }
+
+  // rank 2 from LayoutRight to LayoutLeft and back
+  Kokkos::View<double**, Kokkos::LayoutRight, TEST_EXECSPACE> r2("r2", n0, n1);
+  Kokkos::View<double**, Kokkos::LayoutLeft, TEST_EXECSPACE> l2("l2", n0, n1);
+  Kokkos::deep_copy(r2, h_r2);
+  Kokkos::deep_copy(l2, r2);
+  Kokkos::deep_copy(r2, 0.);
+  Kokkos::deep_copy(TEST_EXECSPACE(), r2, l2);
+  auto h_l2 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), l2);
+  Kokkos::deep_copy(h_r2, r2);
+  int errors = 0;
+  for (int i0 = 0; i0 < n0; ++i0) {
+    for (int i1 = 0; i1 < n1; ++i1) {
+      if (h_l2(i0, i1) != i0 * n1 + i1) ++errors;
+      if (h_r2(i0, i1) != i0 * n1 + i1) ++errors;
+    }
+  }
+  ASSERT_EQ(errors, 0);
+
+  // rank 3 from LayoutLeft to LayoutRight with conversion of the values
+  Kokkos::View<int***, Kokkos::LayoutLeft, TEST_EXECSPACE> l3("l3", n0, n2, n1);
+  Kokkos::View<double***, Kokkos::LayoutRight, TEST_EXECSPACE> r3("r3", n0, n2,
+                                                                   n1);
+  Kokkos::deep_copy(l3, h_l3);
+  Kokkos::deep_copy(r3, l3);
+  auto h_r3 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), r3);
+  for (int i0 = 0; i0 < n0; ++i0) {
+    for (int i2 = 0; i2 < n2; ++i2) {
+      for (int i1 = 0; i1 < n1; ++i1) {
+        if (h_r3(i0, i2, i1) != (i0 * n2 + i2) * n1 + i1) ++errors;
+      }
+    }
+  }
+  ASSERT_EQ(errors, 0);
+
+  // strided subview of a LayoutLeft view into a LayoutRight view
+  auto l3_sub = Kokkos::subview(l3, Kokkos::ALL, 3, Kokkos::ALL);
+  Kokkos::View<int**, Kokkos::LayoutRight, TEST_EXECSPACE> r2_sub("r2_sub",
+                                                                  n0, n1);
+  Kokkos::deep_copy(r2_sub, l3_sub);
+  auto h_r2_sub =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), r2_sub);
+  for (int i0 = 0; i0 < n0; ++i0) {
+    for (int i1 = 0; i1 < n1; ++i1) {
+      if (h_r2_sub(i0, i1) != (i0 * n2 + 3) * n1 + i1) ++errors;
+    }
+  }
+  ASSERT_EQ(errors, 0);
+}
+
 TEST(TEST_CATEGORY, view_copy_degenerated) {
   Kokkos::View<int*, TEST_EXECSPACE, Kokkos::MemoryTraits<Kokkos::Unmanaged>>
       v_um_def_1;
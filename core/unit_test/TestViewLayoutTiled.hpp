@@ -0,0 +1,289 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+namespace Test {
+
+namespace {
+
+using Kokkos::Experimental::LayoutTiled;
+using Kokkos::Experimental::TileOrder;
+
+// Every entry is mapped to its own offset within the span and the entries
+// of a tile are contiguous
+template <class Layout>
+void check_tiled_mapping_2d(const size_t n0, const size_t n1) {
+  Kokkos::View<int**, Layout, Kokkos::HostSpace> v("v", n0, n1);
+  ASSERT_EQ(v.extent(0), n0);
+  ASSERT_EQ(v.extent(1), n1);
+  ASSERT_EQ(v.size(), n0 * n1);
+  ASSERT_GE(v.span(), v.size());
+  ASSERT_EQ(v.span_is_contiguous(), v.span() == v.size());
+
+  constexpr size_t tile = Layout::N0 * Layout::N1;
+  std::vector<bool> used(v.span(), false);
+  for (size_t i0 = 0; i0 < n0; ++i0) {
+    for (size_t i1 = 0; i1 < n1; ++i1) {
+      const size_t offset = &v(i0, i1) - v.data();
+      ASSERT_LT(offset, v.span());
+      ASSERT_FALSE(used[offset]);
+      used[offset] = true;
+      const size_t tile_start =
+          &v(i0 - i0 % Layout::N0, i1 - i1 % Layout::N1) - v.data();
+      ASSERT_EQ(tile_start % tile, 0u);
+      ASSERT_LT(offset - tile_start, tile);
+    }
+  }
+}
+
+template <class Layout>
+void check_tiled_mapping_3d(const size_t n0, const size_t n1,
+                            const size_t n2) {
+  Kokkos::View<int***, Layout, Kokkos::HostSpace> v("v", n0, n1, n2);
+  ASSERT_EQ(v.size(), n0 * n1 * n2);
+  ASSERT_GE(v.span(), v.size());
+
+  constexpr size_t tile = Layout::N0 * Layout::N1 * Layout::N2;
+  std::vector<bool> used(v.span(), false);
+  for (size_t i0 = 0; i0 < n0; ++i0) {
+    for (size_t i1 = 0; i1 < n1; ++i1) {
+      for (size_t i2 = 0; i2 < n2; ++i2) {
+        const size_t offset = &v(i0, i1, i2) - v.data();
+        ASSERT_LT(offset, v.span());
+        ASSERT_FALSE(used[offset]);
+        used[offset] = true;
+        const size_t tile_start =
+            &v(i0 - i0 % Layout::N0, i1 - i1 % Layout::N1,
+               i2 - i2 % Layout::N2) -
+            v.data();
+        ASSERT_LT(offset - tile_start, tile);
+      }
+    }
+  }
+}
+
+template <class Layout>
+void check_tiled_subview_3d() {
+  Kokkos::View<int***, Layout, Kokkos::HostSpace> v("v", 37, 21, 50);
+  auto sub = Kokkos::subview(v, Kokkos::pair<int, int>(5, 30), Kokkos::ALL,
+                             Kokkos::pair<int, int>(9, 41));
+  static_assert(std::is_same_v<typename decltype(sub)::array_layout, Layout>);
+  ASSERT_EQ(sub.extent(0), 25u);
+  ASSERT_EQ(sub.extent(1), 21u);
+  ASSERT_EQ(sub.extent(2), 32u);
+  ASSERT_FALSE(sub.span_is_contiguous());
+
+  auto subsub = Kokkos::subview(sub, Kokkos::pair<int, int>(3, 20),
+                                Kokkos::pair<int, int>(1, 20), Kokkos::ALL);
+  for (size_t i0 = 0; i0 < sub.extent(0); ++i0) {
+    for (size_t i1 = 0; i1 < sub.extent(1); ++i1) {
+      for (size_t i2 = 0; i2 < sub.extent(2); ++i2) {
+        ASSERT_EQ(&sub(i0, i1, i2), &v(i0 + 5, i1, i2 + 9));
+        ASSERT_GE(&sub(i0, i1, i2), sub.data());
+        ASSERT_LT(&sub(i0, i1, i2), sub.data() + sub.span());
+      }
+    }
+  }
+  for (size_t i0 = 0; i0 < subsub.extent(0); ++i0) {
+    for (size_t i1 = 0; i1 < subsub.extent(1); ++i1) {
+      for (size_t i2 = 0; i2 < subsub.extent(2); ++i2) {
+        ASSERT_EQ(&subsub(i0, i1, i2), &v(i0 + 8, i1 + 1, i2 + 9));
+      }
+    }
+  }
+}
+
+template <class Layout>
+void check_tiled_deep_copy_3d() {
+  using exec_space = TEST_EXECSPACE;
+  const int n0 = 19, n1 = 35, n2 = 42;
+
+  Kokkos::View<double***, Kokkos::LayoutRight, exec_space> right("right", n0,
+                                                                 n1, n2);
+  Kokkos::View<double***, Layout, exec_space> tiled("tiled", n0, n1, n2);
+  Kokkos::View<double***, Layout, exec_space> tiled_copy("tiled_copy", n0, n1,
+                                                         n2);
+  Kokkos::View<double***, Kokkos::LayoutLeft, exec_space> left("left", n0, n1,
+                                                               n2);
+  Kokkos::parallel_for(
+      Kokkos::MDRangePolicy<exec_space, Kokkos::Rank<3>>({0, 0, 0},
+                                                         {n0, n1, n2}),
+      KOKKOS_LAMBDA(int i0, int i1, int i2) {
+        right(i0, i1, i2) = 10000 * i0 + 100 * i1 + i2;
+      });
+  Kokkos::deep_copy(tiled, right);
+  Kokkos::deep_copy(tiled_copy, tiled);
+  Kokkos::deep_copy(left, tiled_copy);
+
+  // copy between subviews of tiled views
+  Kokkos::View<double***, Layout, exec_space> window("window", 10, 20, 30);
+  Kokkos::deep_copy(
+      Kokkos::subview(window, Kokkos::pair<int, int>(1, 9),
+                      Kokkos::pair<int, int>(2, 18), Kokkos::ALL),
+      Kokkos::subview(tiled, Kokkos::pair<int, int>(4, 12),
+                      Kokkos::pair<int, int>(7, 23),
+                      Kokkos::pair<int, int>(11, 41)));
+
+  auto h_left =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), left);
+  auto h_window =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), window);
+  for (int i0 = 0; i0 < n0; ++i0) {
+    for (int i1 = 0; i1 < n1; ++i1) {
+      for (int i2 = 0; i2 < n2; ++i2) {
+        ASSERT_EQ(h_left(i0, i1, i2), 10000 * i0 + 100 * i1 + i2);
+      }
+    }
+  }
+  for (int i0 = 0; i0 < 10; ++i0) {
+    for (int i1 = 0; i1 < 20; ++i1) {
+      for (int i2 = 0; i2 < 30; ++i2) {
+        const bool inside = 1 <= i0 && i0 < 9 && 2 <= i1 && i1 < 18;
+        ASSERT_EQ(h_window(i0, i1, i2),
+                  inside ? 10000 * (i0 + 3) + 100 * (i1 + 5) + (i2 + 11) : 0);
+      }
+    }
+  }
+}
+
+template <class Layout>
+void check_tiled_fill_2d() {
+  using exec_space = TEST_EXECSPACE;
+  const int n0 = 37, n1 = 50;
+
+  Kokkos::View<int**, Layout, exec_space> v("v", n0, n1);
+  auto sub = Kokkos::subview(v, Kokkos::pair<int, int>(3, 30),
+                             Kokkos::pair<int, int>(5, 41));
+  Kokkos::deep_copy(v, 1);
+  Kokkos::deep_copy(sub, 2);
+  Kokkos::deep_copy(exec_space(),
+                    Kokkos::subview(v, Kokkos::pair<int, int>(10, 12),
+                                    Kokkos::ALL),
+                    3);
+  exec_space().fence();
+
+  auto h_v = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+  for (int i0 = 0; i0 < n0; ++i0) {
+    for (int i1 = 0; i1 < n1; ++i1) {
+      const int expected = (10 <= i0 && i0 < 12)                  ? 3
+                           : (3 <= i0 && i0 < 30 && 5 <= i1 && i1 < 41) ? 2
+                                                                       : 1;
+      ASSERT_EQ(h_v(i0, i1), expected);
+    }
+  }
+}
+
+template <class Layout>
+void check_tile_aligned_policy_2d() {
+  using exec_space = TEST_EXECSPACE;
+  const int n0 = 45, n1 = 70;
+
+  Kokkos::View<int**, Layout, exec_space> v("v", n0, n1);
+  auto policy = Kokkos::Experimental::tile_aligned_policy(exec_space(), v);
+  ASSERT_EQ(policy.m_tile[0], int64_t(Layout::N0));
+  ASSERT_EQ(policy.m_tile[1], int64_t(Layout::N1));
+  ASSERT_EQ(policy.m_upper[0], n0);
+  ASSERT_EQ(policy.m_upper[1], n1);
+  Kokkos::parallel_for(
+      policy, KOKKOS_LAMBDA(int i0, int i1) { v(i0, i1) = 1000 * i0 + i1; });
+
+  auto h_v = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+  for (int i0 = 0; i0 < n0; ++i0) {
+    for (int i1 = 0; i1 < n1; ++i1) {
+      ASSERT_EQ(h_v(i0, i1), 1000 * i0 + i1);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(TEST_CATEGORY, view_layout_tiled_mapping) {
+  check_tiled_mapping_2d<LayoutTiled<TileOrder::Left, Kokkos::Iterate::Left,
+                                     4, 8>>(13, 30);
+  check_tiled_mapping_2d<LayoutTiled<TileOrder::Right, Kokkos::Iterate::Left,
+                                     4, 2>>(16, 8);
+  check_tiled_mapping_2d<LayoutTiled<TileOrder::Right, Kokkos::Iterate::Right,
+                                     8, 8>>(1, 100);
+  // large enough grids of tiles to be stored in Morton blocks
+  check_tiled_mapping_2d<LayoutTiled<TileOrder::Morton, Kokkos::Iterate::Right,
+                                     2, 2>>(61, 67);
+  check_tiled_mapping_2d<LayoutTiled<TileOrder::Morton, Kokkos::Iterate::Left,
+                                     2, 4>>(128, 256);
+
+  check_tiled_mapping_3d<LayoutTiled<TileOrder::Left, Kokkos::Iterate::Right,
+                                     4, 4, 4>>(9, 17, 6);
+  check_tiled_mapping_3d<LayoutTiled<TileOrder::Right, Kokkos::Iterate::Left,
+                                     2, 4, 8>>(10, 10, 10);
+  check_tiled_mapping_3d<LayoutTiled<TileOrder::Morton, Kokkos::Iterate::Right,
+                                     1, 1, 2>>(33, 40, 70);
+
+  // tiles of a single entry along a Z-order curve
+  Kokkos::View<int**, LayoutTiled<TileOrder::Morton, Kokkos::Iterate::Right,
+                                  1, 1>,
+               Kokkos::HostSpace>
+      z("z", 256, 256);
+  ASSERT_EQ(&z(0, 1) - z.data(), 1);
+  ASSERT_EQ(&z(1, 0) - z.data(), 2);
+  ASSERT_EQ(&z(1, 1) - z.data(), 3);
+  ASSERT_EQ(&z(0, 2) - z.data(), 4);
+  ASSERT_EQ(&z(2, 0) - z.data(), 8);
+
+  // empty views
+  Kokkos::View<int***, LayoutTiled<TileOrder::Morton, Kokkos::Iterate::Right,
+                                   4, 4, 4>,
+               Kokkos::HostSpace>
+      empty("empty", 0, 10, 10);
+  ASSERT_EQ(empty.span(), 0u);
+}
+
+TEST(TEST_CATEGORY, view_layout_tiled_subview) {
+  check_tiled_subview_3d<
+      LayoutTiled<TileOrder::Right, Kokkos::Iterate::Right, 4, 4, 8>>();
+  check_tiled_subview_3d<
+      LayoutTiled<TileOrder::Left, Kokkos::Iterate::Left, 8, 2, 4>>();
+  check_tiled_subview_3d<
+      LayoutTiled<TileOrder::Morton, Kokkos::Iterate::Right, 1, 1, 1>>();
+}
+
+TEST(TEST_CATEGORY, view_layout_tiled_deep_copy) {
+  check_tiled_deep_copy_3d<
+      LayoutTiled<TileOrder::Right, Kokkos::Iterate::Right, 4, 8, 8>>();
+  check_tiled_deep_copy_3d<
+      LayoutTiled<TileOrder::Morton, Kokkos::Iterate::Left, 2, 2, 2>>();
+}
+
+TEST(TEST_CATEGORY, view_layout_tiled_fill) {
+  check_tiled_fill_2d<
+      LayoutTiled<TileOrder::Right, Kokkos::Iterate::Right, 4, 8>>();
+  check_tiled_fill_2d<
+      LayoutTiled<TileOrder::Morton, Kokkos::Iterate::Left, 2, 4>>();
+}
+
+TEST(TEST_CATEGORY, view_layout_tiled_policy) {
+  check_tile_aligned_policy_2d<
+      LayoutTiled<TileOrder::Right, Kokkos::Iterate::Right, 8, 16>>();
+  check_tile_aligned_policy_2d<
+      LayoutTiled<TileOrder::Left, Kokkos::Iterate::Left, 4, 4>>();
+  check_tile_aligned_policy_2d<
+      LayoutTiled<TileOrder::Morton, Kokkos::Iterate::Right, 2, 2>>();
+}
+
+}  // namespace Test
@@ -108,6 +108,96 @@ TEST(TEST_CATEGORY, view_mapping_atomic) {
 
 namespace Test {
 
+template <class Space>
+struct TestViewMappingStreaming {
+  using ExecSpace = typename Space::execution_space;
+
+  using mem_trait = Kokkos::MemoryTraits<Kokkos::Streaming>;
+
+  using T        = Kokkos::View<double **, ExecSpace>;
+  using T_stream = Kokkos::View<double **, ExecSpace, mem_trait>;
+  using T_int    = Kokkos::View<int *, ExecSpace, mem_trait>;
+
+  T x;
+  T_stream x_stream;
+  T_int y_stream;
+
+  enum { N0 = 1000, N1 = 37 };
+
+  struct TagWrite {};
+  struct TagCopy {};
+  struct TagVerify {};
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagWrite &, const int i) const {
+    for (int j = 0; j < N1; ++j) x_stream(i, j) = i * N1 + j;
+    y_stream(i) = i;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagCopy &, const int i) const {
+    // Streaming to streaming assignment copies the value
+    x_stream(i, 0) = x_stream(i, N1 - 1);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagVerify &, const int i, long &error_count) const {
+    if (x(i, 0) != double(i * N1 + N1 - 1)) ++error_count;
+    for (int j = 1; j < N1; ++j) {
+      if (x(i, j) != double(i * N1 + j)) ++error_count;
+    }
+    if (y_stream(i) != i) ++error_count;
+  }
+
+  TestViewMappingStreaming() : x("x", N0, N1), x_stream(x), y_stream("y", N0) {}
+
+  void run() {
+    static_assert(mem_trait::is_streaming);
+    static_assert(!Kokkos::MemoryManaged::is_streaming);
+    ASSERT_TRUE(T::reference_type_is_lvalue_reference);
+    ASSERT_FALSE(T_stream::reference_type_is_lvalue_reference);
+    // Reads through a const view are regular loads
+    ASSERT_TRUE(
+        (Kokkos::View<const double **, ExecSpace,
+                      mem_trait>::reference_type_is_lvalue_reference));
+    ASSERT_EQ(x.data(), x_stream.data());
+
+    Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace, TagWrite>(0, N0),
+                         *this);
+    Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace, TagCopy>(0, N0),
+                         *this);
+
+    long error_count = -1;
+    Kokkos::parallel_reduce(Kokkos::RangePolicy<ExecSpace, TagVerify>(0, N0),
+                            *this, error_count);
+    ASSERT_EQ(0, error_count);
+
+    // deep_copy into and out of a streaming view
+    T_stream z_stream("z", N0, N1);
+    Kokkos::deep_copy(z_stream, 3.);
+    Kokkos::deep_copy(x, z_stream);
+    auto x_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+    for (int i = 0; i < N0; ++i) {
+      for (int j = 0; j < N1; ++j) ASSERT_EQ(x_host(i, j), 3.);
+    }
+
+    auto sv = Kokkos::subview(x_stream, 5, Kokkos::ALL);
+    static_assert(decltype(sv)::memory_traits::is_streaming);
+    ASSERT_EQ(sv.data(), x.data() + x.stride(0) * 5);
+  }
+};
+
+TEST(TEST_CATEGORY, view_mapping_streaming) {
+  TestViewMappingStreaming<TEST_EXECSPACE> f;
+  f.run();
+}
+
+}  // namespace Test
+
+/*--------------------------------------------------------------------------*/
+
+namespace Test {
+
 struct MappingClassValueType {
   KOKKOS_INLINE_FUNCTION
   MappingClassValueType() {
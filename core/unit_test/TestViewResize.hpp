@@ -32,5 +32,128 @@ TEST(TEST_CATEGORY, view_realloc) {
   TestViewRealloc::testRealloc<ExecSpace>();
 }
 
+// The first `preserved` rows hold i * 1000 + j in their first 7 columns
+template <class ViewType>
+int count_resize_errors(const ViewType& v, const int preserved) {
+  auto h_v = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+  int errors = 0;
+  for (int i = 0; i < int(v.extent(0)); ++i) {
+    for (int j = 0; j < int(v.extent(1)); ++j) {
+      const double expected = i < preserved && j < 7 ? i * 1000 + j : 0.;
+      if (h_v(i, j) != expected) ++errors;
+    }
+  }
+  return errors;
+}
+
+TEST(TEST_CATEGORY, view_resize_capacity) {
+  using ExecSpace = TEST_EXECSPACE;
+  if (!std::is_same_v<ExecSpace::memory_space, Kokkos::HostSpace>)
+    GTEST_SKIP() << "skipping since capacity only applies to HostSpace";
+
+  ASSERT_EQ(Kokkos::Experimental::get_host_view_growth_factor(), 1.5);
+
+  using view_type = Kokkos::View<double**, Kokkos::LayoutRight, ExecSpace>;
+  view_type v("v", 100, 7);
+  Kokkos::parallel_for(
+      Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<2>>({0, 0}, {100, 7}),
+      KOKKOS_LAMBDA(int i, int j) { v(i, j) = i * 1000 + j; });
+
+  // Growing reallocates with spare capacity ...
+  Kokkos::resize(v, 200, 7);
+  const double* const ptr = v.data();
+  ASSERT_EQ(v.extent(0), 200u);
+  ASSERT_EQ(count_resize_errors(v, 100), 0);
+
+  // ... so that growing again is done in place, initializing the new rows
+  Kokkos::resize(v, 300, 7);
+  ASSERT_EQ(v.data(), ptr);
+  ASSERT_EQ(v.use_count(), 1);
+  ASSERT_EQ(count_resize_errors(v, 100), 0);
+
+  // Shrinking moderately stays in place
+  Kokkos::resize(v, 160, 7);
+  ASSERT_EQ(v.data(), ptr);
+  ASSERT_EQ(count_resize_errors(v, 100), 0);
+
+  // Views sharing the allocation must keep their data
+  view_type w = v;
+  Kokkos::resize(v, 170, 7);
+  ASSERT_NE(v.data(), w.data());
+  ASSERT_EQ(count_resize_errors(v, 100), 0);
+  w = view_type();
+
+  // Changing any other extent reallocates
+  Kokkos::resize(v, 170, 8);
+  ASSERT_EQ(count_resize_errors(v, 100), 0);
+
+  // realloc reuses the allocation as well
+  const double* const ptr_realloc = v.data();
+  Kokkos::realloc(v, 150, 8);
+  ASSERT_EQ(v.data(), ptr_realloc);
+  ASSERT_EQ(count_resize_errors(v, 0), 0);
+
+  // Shrinking below half of the allocation releases it
+  Kokkos::resize(v, 10, 8);
+  ASSERT_NE(v.data(), ptr_realloc);
+
+  // With a growth factor of 1 there is no spare capacity
+  Kokkos::Experimental::set_host_view_growth_factor(1.);
+  Kokkos::resize(v, 20, 8);
+  const double* const ptr_exact = v.data();
+  Kokkos::resize(v, 21, 8);
+  ASSERT_NE(v.data(), ptr_exact);
+  Kokkos::Experimental::set_host_view_growth_factor(1.5);
+  ASSERT_THROW(Kokkos::Experimental::set_host_view_growth_factor(0.5),
+               std::runtime_error);
+
+  // LayoutLeft Views grow along their last extent
+  Kokkos::View<int**, Kokkos::LayoutLeft, ExecSpace> u("u", 9, 100);
+  Kokkos::resize(u, 9, 200);
+  const int* const ptr_left = u.data();
+  Kokkos::resize(u, 9, 250);
+  ASSERT_EQ(u.data(), ptr_left);
+
+  // Large allocations are grown by remapping their pages
+  Kokkos::View<char*, ExecSpace> c("c",
+                                   Kokkos::Impl::host_space_remap_threshold);
+  const size_t n = c.extent(0);
+  Kokkos::deep_copy(c, 1);
+  Kokkos::resize(Kokkos::WithoutInitializing, c, 2 * n);
+  Kokkos::resize(c, 3 * n);
+  int c_errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<ExecSpace>(0, 3 * n),
+      KOKKOS_LAMBDA(int i, int& err) {
+        if (i < int(n) ? c(i) != 1 : (2 * n <= size_t(i) && c(i) != 0)) ++err;
+      },
+      c_errors);
+  ASSERT_EQ(c_errors, 0);
+}
+
+TEST(TEST_CATEGORY, view_resize_padded) {
+  using ExecSpace = TEST_EXECSPACE;
+  using view_type = Kokkos::View<double**, Kokkos::LayoutRight, ExecSpace>;
+  view_type v(Kokkos::view_alloc("v", Kokkos::AllowPadding), 10, 1001);
+  if (v.span() == v.size()) GTEST_SKIP() << "skipping since v is not padded";
+
+  Kokkos::parallel_for(
+      Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<2>>({0, 0}, {10, 1001}),
+      KOKKOS_LAMBDA(int i, int j) { v(i, j) = i * 10000 + j; });
+
+  // Shrinking keeps most of the allocation in use, the rows must still be
+  // read with the padded stride
+  Kokkos::resize(v, 8, 1001);
+  ASSERT_EQ(v.extent(0), 8u);
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<2>>({0, 0}, {8, 1001}),
+      KOKKOS_LAMBDA(int i, int j, int& err) {
+        if (v(i, j) != i * 10000 + j) ++err;
+      },
+      errors);
+  ASSERT_EQ(errors, 0);
+}
+
 }  // namespace Test
 #endif  // TESTVIEWRESIZE_HPP_
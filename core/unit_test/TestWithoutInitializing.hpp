@@ -203,6 +203,48 @@ TEST(TEST_CATEGORY, view_alloc_exec_space_int) {
   listen_tool_events(Config::DisableAll());
 }
 
+TEST(TEST_CATEGORY, view_alloc_host_first_touch) {
+  using view_type = Kokkos::View<double*, TEST_EXECSPACE>;
+  if (!std::is_same_v<view_type::memory_space, Kokkos::HostSpace> ||
+      TEST_EXECSPACE().concurrency() < 2)
+    GTEST_SKIP() << "skipping since first touch only applies to HostSpace "
+                    "Views on parallel execution spaces";
+
+  using namespace Kokkos::Test::Tools;
+  listen_tool_events(Config::DisableAll(), Config::EnableKernels());
+  // At least a page per thread
+  const int n = TEST_EXECSPACE().concurrency() * 4096;
+  view_type outer_view;
+
+  auto is_parallel_init = [](BeginParallelForEvent event) {
+    return MatchDiagnostic{
+        event.name == "Kokkos::View::initialization [bla]"};
+  };
+  ASSERT_TRUE(validate_existence(
+      [&]() {
+        view_type inner_view("bla", n);
+        outer_view = inner_view;
+      },
+      is_parallel_init));
+  ASSERT_TRUE(validate_existence(
+      [&]() { Kokkos::realloc(outer_view, 2 * n); }, is_parallel_init));
+  ASSERT_TRUE(validate_existence(
+      [&]() { Kokkos::resize(outer_view, 3 * n); }, is_parallel_init));
+  // Small allocations keep the memset
+  ASSERT_TRUE(validate_absence([&]() { view_type small_view("bla", 8); },
+                               is_parallel_init));
+  listen_tool_events(Config::DisableAll());
+
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, outer_view.size()),
+      KOKKOS_LAMBDA(int i, int& err) {
+        if (outer_view(i) != 0.) ++err;
+      },
+      errors);
+  ASSERT_EQ(errors, 0);
+}
+
 TEST(TEST_CATEGORY, deep_copy_zero_memset) {
 // FIXME_OPENMPTARGET The OpenMPTarget backend doesn't implement ZeroMemset
 #ifdef KOKKOS_ENABLE_OPENMPTARGET
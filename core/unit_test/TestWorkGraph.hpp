@@ -128,6 +128,67 @@ struct TestWorkGraph {
   }
 };
 
+// Stages of independent work, each work of a stage coming after all the work
+// of the previous one, so that each work makes many others ready at once
+template <class ExecSpace>
+struct TestWorkGraphStages {
+  using MemorySpace = typename ExecSpace::memory_space;
+  using Policy      = Kokkos::WorkGraphPolicy<std::int32_t, ExecSpace>;
+  using Graph       = typename Policy::graph_type;
+  using Flags       = Kokkos::View<int*, MemorySpace>;
+
+  Graph m_graph;
+  Flags m_done;
+  Kokkos::View<int, MemorySpace> m_errors;
+
+  TestWorkGraphStages(int num_stages, int width) {
+    const int num_work = num_stages * width;
+    m_graph.row_map = typename Graph::row_map_type("row_map", num_work + 1);
+    m_graph.entries = typename Graph::entries_type(
+        "entries", (num_stages - 1) * width * width);
+    m_done   = Flags("done", num_work);
+    m_errors = Kokkos::View<int, MemorySpace>("errors");
+    auto h_row_map = Kokkos::create_mirror_view(m_graph.row_map);
+    auto h_entries = Kokkos::create_mirror_view(m_graph.entries);
+    int k          = 0;
+    for (int w = 0; w < num_work; ++w) {
+      h_row_map(w) = k;
+      if (w / width + 1 < num_stages) {
+        for (int j = 0; j < width; ++j) {
+          h_entries(k++) = (w / width + 1) * width + j;
+        }
+      }
+    }
+    h_row_map(num_work) = k;
+    Kokkos::deep_copy(m_graph.row_map, h_row_map);
+    Kokkos::deep_copy(m_graph.entries, h_entries);
+  }
+
+  // None of the work coming after w may have run yet
+  KOKKOS_INLINE_FUNCTION
+  void operator()(std::int32_t w) const {
+    for (auto i = m_graph.row_map(w); i < m_graph.row_map(w + 1); ++i) {
+      if (Kokkos::atomic_load(&m_done(m_graph.entries(i))) != 0) {
+        Kokkos::atomic_inc(&m_errors());
+      }
+    }
+    Kokkos::atomic_store(&m_done(w), 1);
+  }
+
+  void test_for() {
+    Kokkos::parallel_for(Policy(m_graph), *this);
+    Kokkos::fence();
+    int errors = 0;
+    Kokkos::deep_copy(errors, m_errors);
+    ASSERT_EQ(errors, 0);
+    auto h_done =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), m_done);
+    for (int w = 0; w < int(h_done.extent(0)); ++w) {
+      ASSERT_EQ(h_done(w), 1) << "work " << w;
+    }
+  }
+};
+
 }  // anonymous namespace
 
 TEST(TEST_CATEGORY, workgraph_fib) {
@@ -140,4 +201,12 @@ TEST(TEST_CATEGORY, workgraph_fib) {
   // f.test_for();
 }
 
+TEST(TEST_CATEGORY, workgraph_stages) {
+  // wider than the per-thread ready lists of the host backends
+  for (int width : {1, 3, 40}) {
+    TestWorkGraphStages<TEST_EXECSPACE> f(8, width);
+    f.test_for();
+  }
+}
+
 }  // namespace Test
@@ -0,0 +1,117 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <TestOpenMP_Category.hpp>
+
+namespace {
+
+TEST(openmp, async_dispatch_returns_before_completion) {
+  Kokkos::OpenMP exec;
+  Kokkos::View<int, Kokkos::HostSpace> released("released");
+  Kokkos::View<int, Kokkos::HostSpace> ran("ran");
+
+#if defined(KOKKOS_ENABLE_IMPL_OPENMP_ASYNC_DISPATCH)
+  // The kernel can only complete after the launch returned
+  Kokkos::parallel_for(
+      "Test::openmp::async_dispatch::wait_for_release",
+      Kokkos::RangePolicy<Kokkos::OpenMP>(exec, 0, 1), KOKKOS_LAMBDA(int) {
+        while (Kokkos::atomic_load(&released()) == 0) {
+        }
+        ran() = 1;
+      });
+  Kokkos::atomic_store(&released(), 1);
+#else
+  Kokkos::parallel_for(
+      "Test::openmp::async_dispatch::run",
+      Kokkos::RangePolicy<Kokkos::OpenMP>(exec, 0, 1),
+      KOKKOS_LAMBDA(int) { ran() = 1; });
+  ASSERT_EQ(ran(), 1);
+#endif
+  exec.fence();
+  ASSERT_EQ(ran(), 1);
+}
+
+TEST(openmp, async_dispatch_ordering) {
+  Kokkos::OpenMP exec;
+  const int n = 100000;
+  Kokkos::View<int*, Kokkos::HostSpace> a("a", n);
+  Kokkos::View<int*, Kokkos::HostSpace> b("b", n);
+  Kokkos::View<long, Kokkos::HostSpace> sum("sum");
+
+  // Kernels, deep copies and reductions on an instance run in order
+  const int iterations = 10;
+  for (int iteration = 0; iteration < iterations; ++iteration) {
+    Kokkos::parallel_for(
+        "Test::openmp::async_dispatch::increment",
+        Kokkos::RangePolicy<Kokkos::OpenMP>(exec, 0, n),
+        KOKKOS_LAMBDA(int i) { a(i) += 1; });
+    Kokkos::deep_copy(exec, b, a);
+    Kokkos::parallel_for(
+        "Test::openmp::async_dispatch::scale",
+        Kokkos::RangePolicy<Kokkos::OpenMP>(exec, 0, n),
+        KOKKOS_LAMBDA(int i) { a(i) = 2 * b(i); });
+  }
+  Kokkos::parallel_reduce(
+      "Test::openmp::async_dispatch::sum",
+      Kokkos::RangePolicy<Kokkos::OpenMP>(exec, 0, n),
+      KOKKOS_LAMBDA(int i, long& update) { update += a(i); }, sum);
+  exec.fence();
+
+  // a = 2 * (a + 1) applied iterations times starting from 0
+  long expected = 0;
+  for (int iteration = 0; iteration < iterations; ++iteration) {
+    expected = 2 * (expected + 1);
+  }
+  ASSERT_EQ(sum(), expected * n);
+
+  // A scalar result is available when the reduction returns
+  long scalar_sum = 0;
+  Kokkos::parallel_reduce(
+      "Test::openmp::async_dispatch::scalar_sum",
+      Kokkos::RangePolicy<Kokkos::OpenMP>(exec, 0, n),
+      KOKKOS_LAMBDA(int i, long& update) { update += b(i); }, scalar_sum);
+  ASSERT_EQ(scalar_sum, (expected / 2) * n);
+}
+
+TEST(openmp, async_dispatch_released_instance) {
+  Kokkos::OpenMP exec;
+  if (exec.concurrency() < 2) {
+    GTEST_SKIP() << "insufficient number of threads to partition";
+  }
+
+  const int n = 1000;
+  Kokkos::View<int*, Kokkos::HostSpace> a("a", n);
+  {
+    // The kernels keep the instances alive until they completed
+    auto instances = Kokkos::Experimental::partition_space(exec, 1, 1);
+    for (auto const& instance : instances) {
+      Kokkos::parallel_for(
+          "Test::openmp::async_dispatch::released_instance",
+          Kokkos::RangePolicy<Kokkos::OpenMP>(instance, 0, n),
+          KOKKOS_LAMBDA(int i) { Kokkos::atomic_add(&a(i), 1); });
+    }
+  }
+  Kokkos::fence();
+
+  int errors = 0;
+  for (int i = 0; i < n; ++i) {
+    if (a(i) != 2) ++errors;
+  }
+  ASSERT_EQ(errors, 0);
+}
+
+}  // namespace
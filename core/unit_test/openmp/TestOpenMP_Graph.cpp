@@ -0,0 +1,167 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Graph.hpp>
+#include <TestOpenMP_Category.hpp>
+
+namespace {
+
+// Signals its own flag and waits a bounded time for the flag of the other
+// branch, which only gets set in time if both branches run concurrently
+struct MeetOtherBranch {
+  Kokkos::View<int[2], Kokkos::HostSpace> flags;
+  Kokkos::View<int[2], Kokkos::HostSpace> met;
+  int self;
+
+  void operator()(int) const {
+    Kokkos::atomic_store(&flags(self), 1);
+    Kokkos::Timer timer;
+    while (timer.seconds() < 10.) {
+      if (Kokkos::atomic_load(&flags(1 - self)) == 1) {
+        met(self) = 1;
+        return;
+      }
+    }
+  }
+};
+
+// Records the order in which the iterations ran
+struct StampIterations {
+  Kokkos::View<int*, Kokkos::HostSpace> stamps;
+  Kokkos::View<int, Kokkos::HostSpace> clock;
+
+  void operator()(int i) const {
+    stamps(i) = Kokkos::atomic_fetch_add(&clock(), 1);
+  }
+};
+
+TEST(openmp, graph_overlaps_independent_branches) {
+  const int max_active_levels = omp_get_max_active_levels();
+  omp_set_max_active_levels(2);
+  if (!Kokkos::Impl::is_nested_parallelism_enabled()) {
+    omp_set_max_active_levels(max_active_levels);
+    GTEST_SKIP() << "nested parallelism is not available";
+  }
+
+  const Kokkos::OpenMP exec;
+  const Kokkos::OpenMP exec_0(1);
+  const Kokkos::OpenMP exec_1(1);
+
+  Kokkos::View<int[2], Kokkos::HostSpace> flags("flags");
+  Kokkos::View<int[2], Kokkos::HostSpace> met("met");
+  Kokkos::View<int, Kokkos::HostSpace> joined("joined");
+
+  using policy_t = Kokkos::RangePolicy<Kokkos::OpenMP>;
+
+  auto graph = Kokkos::Experimental::create_graph(exec, [&](auto root) {
+    auto branch_0 = root.then_parallel_for(policy_t(exec_0, 0, 1),
+                                           MeetOtherBranch{flags, met, 0});
+    auto branch_1 = root.then_parallel_for(policy_t(exec_1, 0, 1),
+                                           MeetOtherBranch{flags, met, 1});
+    Kokkos::Experimental::when_all(branch_0, branch_1)
+        .then_parallel_for(policy_t(exec, 0, 1), KOKKOS_LAMBDA(int) {
+          joined() = met(0) + met(1);
+        });
+  });
+  graph.submit(exec);
+  exec.fence();
+  omp_set_max_active_levels(max_active_levels);
+
+  ASSERT_EQ(met(0), 1);
+  ASSERT_EQ(met(1), 1);
+  ASSERT_EQ(joined(), 2);
+}
+
+TEST(openmp, graph_fuses_elementwise_chain) {
+  const Kokkos::OpenMP exec;
+  constexpr int n = 1 << 16;
+
+  Kokkos::View<int*, Kokkos::HostSpace> stamp_a("stamp_a", n);
+  Kokkos::View<int*, Kokkos::HostSpace> stamp_b("stamp_b", n);
+  Kokkos::View<int, Kokkos::HostSpace> clock("clock");
+
+  using policy_t =
+      Kokkos::RangePolicy<Kokkos::OpenMP, Kokkos::Experimental::Elementwise>;
+
+  auto graph = Kokkos::Experimental::create_graph(exec, [&](auto root) {
+    root.then_parallel_for(policy_t(exec, 0, n),
+                           StampIterations{stamp_a, clock})
+        .then_parallel_for(policy_t(exec, 0, n),
+                           StampIterations{stamp_b, clock});
+  });
+  graph.submit(exec);
+  exec.fence();
+
+  // The second kernel started before the first one completed
+  int first_b = n * 2;
+  int last_a  = 0;
+  for (int i = 0; i < n; ++i) {
+    ASSERT_LT(stamp_a(i), stamp_b(i));
+    first_b = std::min(first_b, stamp_b(i));
+    last_a  = std::max(last_a, stamp_a(i));
+  }
+  ASSERT_LT(first_b, last_a);
+}
+
+// Sets the entries of a View to a value
+struct FillEntries {
+  Kokkos::View<int*, Kokkos::HostSpace> data;
+  int value;
+
+  void operator()(int i) const { data(i) = value; }
+};
+
+TEST(openmp, graph_capture_joins_instances_at_fences) {
+  const Kokkos::OpenMP exec;
+  const Kokkos::OpenMP exec_0(1);
+  const Kokkos::OpenMP exec_1(1);
+  constexpr int n = 1000;
+
+  Kokkos::View<int*, Kokkos::HostSpace> data("data", 2 * n);
+  Kokkos::View<int, Kokkos::HostSpace> sum("sum");
+
+  using policy_t = Kokkos::RangePolicy<Kokkos::OpenMP>;
+
+  Kokkos::Experimental::begin_capture(exec);
+  Kokkos::Experimental::begin_capture(exec_0, exec);
+  Kokkos::Experimental::begin_capture(exec_1, exec);
+  ASSERT_THROW(Kokkos::Experimental::begin_capture(exec_1, exec),
+               std::runtime_error);
+  Kokkos::parallel_for(policy_t(exec_0, 0, n), FillEntries{data, 1});
+  Kokkos::parallel_for(policy_t(exec_1, n, 2 * n), FillEntries{data, 2});
+  exec_0.fence();
+  exec_1.fence();
+  Kokkos::parallel_reduce(
+      policy_t(exec, 0, 2 * n),
+      KOKKOS_LAMBDA(int i, int& partial) { partial += data(i); }, sum);
+  // only the instance that began the capture can end it
+  ASSERT_THROW((void)Kokkos::Experimental::end_capture(exec_0),
+               std::runtime_error);
+  auto graph = Kokkos::Experimental::end_capture(exec);
+  ASSERT_EQ(sum(), 0);
+
+  // the instances are no longer captured
+  Kokkos::parallel_for(policy_t(exec_0, 0, 2 * n), FillEntries{data, 0});
+  exec_0.fence();
+  ASSERT_EQ(data(n), 0);
+
+  graph.submit(exec);
+  exec.fence();
+  ASSERT_EQ(sum(), 3 * n);
+}
+
+}  // namespace
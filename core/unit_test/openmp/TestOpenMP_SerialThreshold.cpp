@@ -0,0 +1,114 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <TestOpenMP_Category.hpp>
+#include <omp.h>
+
+#include <set>
+
+namespace {
+
+// The number of distinct threads that executed the iterations of a launch
+int count_threads(const Kokkos::RangePolicy<Kokkos::OpenMP>& policy) {
+  Kokkos::View<int*, Kokkos::HostSpace> thread("thread", policy.end());
+  Kokkos::parallel_for(
+      "Test::openmp::serial_threshold::record_thread", policy,
+      KOKKOS_LAMBDA(int i) { thread(i) = omp_get_thread_num(); });
+  Kokkos::fence();
+  return std::set<int>(thread.data(), thread.data() + thread.size()).size();
+}
+
+TEST(openmp, serial_threshold_policy) {
+  Kokkos::OpenMP exec;
+  const int n = 100;
+
+  Kokkos::RangePolicy<Kokkos::OpenMP> policy(exec, 0, n);
+  ASSERT_EQ(policy.serial_threshold(), -1);
+
+  policy.set_serial_threshold(n + 1);
+  ASSERT_EQ(policy.serial_threshold(), n + 1);
+  ASSERT_EQ(count_threads(policy), 1);
+
+  long sum = 0;
+  Kokkos::parallel_reduce(
+      "Test::openmp::serial_threshold::sum", policy,
+      KOKKOS_LAMBDA(int i, long& update) { update += i; }, sum);
+  ASSERT_EQ(sum, long(n) * (n - 1) / 2);
+
+  // A launch at the threshold uses the pool
+  policy.set_serial_threshold(n);
+  if (exec.concurrency() > 1) {
+    ASSERT_GT(count_threads(policy), 1);
+  }
+
+  sum = 0;
+  Kokkos::parallel_reduce(
+      "Test::openmp::serial_threshold::sum", policy,
+      KOKKOS_LAMBDA(int i, long& update) { update += i; }, sum);
+  ASSERT_EQ(sum, long(n) * (n - 1) / 2);
+}
+
+TEST(openmp, serial_threshold_model) {
+  Kokkos::Impl::HostSerialThreshold learned;
+
+  // Nothing is known before the first measurement
+  ASSERT_EQ(learned.cost_per_iteration(), -1.);
+  ASSERT_EQ(learned.threshold(1e-5, 4), 0);
+
+  // 1ns per iteration and 10us to fork and join four threads
+  learned.record_serial(1000, 1e-6);
+  ASSERT_DOUBLE_EQ(learned.cost_per_iteration(), 1e-9);
+  ASSERT_NEAR(learned.threshold(1e-5, 4), 13333, 1);
+  ASSERT_EQ(learned.threshold(1e-5, 1), 0);
+
+  // 4 threads take 10us + 1ms for 1e6 iterations of 4ns each
+  learned.record_parallel(1000000, 4, 1e-5, 1e-5 + 1e-3);
+  ASSERT_DOUBLE_EQ(learned.cost_per_iteration(), 0.75e-9 + 0.25 * 4e-9);
+
+  // A measurement below the overhead bounds the threshold
+  learned.record_parallel(10, 4, 1e-5, 1e-6);
+  learned.record_parallel(10, 4, 1e-5, 1e-6);
+  ASSERT_GT(learned.threshold(1e-5, 4), 0);
+  for (int i = 0; i < 200; ++i) learned.record_parallel(10, 4, 1e-5, 1e-6);
+  ASSERT_EQ(learned.threshold(1e-5, 4), int64_t(1) << 24);
+}
+
+TEST(openmp, serial_threshold_learned) {
+  Kokkos::OpenMP exec;
+  Kokkos::Impl::HostSerialThreshold& learned =
+      Kokkos::Impl::get_host_serial_threshold(
+          "Test::openmp::serial_threshold::learned");
+  ASSERT_EQ(&learned, &Kokkos::Impl::get_host_serial_threshold(
+                          "Test::openmp::serial_threshold::learned"));
+
+  // A cheap kernel is below the threshold for a short launch
+  learned.record_serial(1000, 1e-6);
+  Kokkos::RangePolicy<Kokkos::OpenMP> policy(exec, 0, 10);
+  policy.impl_set_serial_threshold_state(&learned);
+  ASSERT_EQ(count_threads(policy), 1);
+  ASSERT_GE(learned.cost_per_iteration(), 0.);
+
+  // An explicit threshold takes precedence
+  policy.impl_set_serial_threshold_state(&learned);
+  policy.set_serial_threshold(0);
+  ASSERT_EQ(policy.impl_serial_threshold_state(), nullptr);
+  if (exec.concurrency() > 1) {
+    ASSERT_GT(count_threads(policy), 1);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,197 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+// This file tests the default tuner used when tuning internals without a tool
+
+#include <Kokkos_Core.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#ifdef KOKKOS_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+using ExecSpace = Kokkos::DefaultHostExecutionSpace;
+
+struct TestMDFunctor {
+  Kokkos::View<int**, ExecSpace> a;
+  KOKKOS_FUNCTION void operator()(const int i, const int j) const {
+    a(i, j) += 1;
+  }
+};
+
+struct TestRangeFunctor {
+  Kokkos::View<int*, ExecSpace> a;
+  KOKKOS_FUNCTION void operator()(const int i) const { a(i) += 1; }
+};
+
+// Stands for a tuning tool running the kernels named "tool_serial_range"
+// serially
+bool serial_threshold_requested = false;
+
+void choose_serial_threshold(
+    const size_t, const size_t num_inputs,
+    const Kokkos::Tools::Experimental::VariableValue* inputs,
+    const size_t num_outputs,
+    Kokkos::Tools::Experimental::VariableValue* outputs) {
+  bool kernel = false;
+  for (size_t i = 0; i < num_inputs; ++i) {
+    if (inputs[i].metadata->type ==
+            Kokkos::Tools::Experimental::ValueType::kokkos_value_string &&
+        std::strcmp(inputs[i].value.string_value, "tool_serial_range") == 0) {
+      kernel = true;
+    }
+  }
+  const size_t threshold_id =
+      Kokkos::Tools::Experimental::get_host_serial_threshold_variable_id();
+  for (size_t i = 0; i < num_outputs; ++i) {
+    if (kernel && outputs[i].type_id == threshold_id) {
+      serial_threshold_requested = true;
+      outputs[i].value.int_value =
+          outputs[i].metadata->candidates.range.upper.int_value;
+    }
+  }
+}
+
+int main() {
+  const std::string cache_file = "kokkos_default_tuner_test_cache.txt";
+  {
+    std::ofstream cache(cache_file);
+    cache << "# Kokkos default tuner cache\n";
+    cache << "1 3 cached_problem\n";
+  }
+  Kokkos::initialize(Kokkos::InitializationSettings()
+                         .set_tune_internals(true)
+                         .set_tuning_cache(cache_file));
+  {
+    using namespace Kokkos::Tools::Experimental;
+    if (!have_default_tuner()) {
+      throw std::runtime_error("Default tuner should be active");
+    }
+
+    // a cached configuration is used without any exploration
+    std::vector<int64_t> configuration;
+    auto cached = Impl::declare_default_tuning_problem(
+        "cached_problem", {{1}, {2}, {3}, {4}});
+    auto token = Impl::begin_default_tuning(cached, configuration);
+    if (configuration != std::vector<int64_t>{3} || token.measuring ||
+        Impl::default_tuning_is_measuring(cached)) {
+      throw std::runtime_error("Cached configuration was not used");
+    }
+    Impl::end_default_tuning(token);
+
+    // exploration tries every candidate and then settles on one of them, each
+    // launch is recorded against its own candidate even when launches overlap
+    auto explored = Impl::declare_default_tuning_problem(
+        "explored_problem", {{1}, {2}, {3}});
+    std::vector<int> tried(3, 0);
+    int launches = 0;
+    while (Impl::default_tuning_is_measuring(explored)) {
+      std::vector<int64_t> other_configuration;
+      auto first  = Impl::begin_default_tuning(explored, configuration);
+      auto second = Impl::begin_default_tuning(explored, other_configuration);
+      if (configuration[0] != int64_t(first.candidate) + 1 ||
+          other_configuration[0] != int64_t(second.candidate) + 1) {
+        throw std::runtime_error("Token does not match the configuration");
+      }
+      ++tried[configuration[0] - 1];
+      ++tried[other_configuration[0] - 1];
+      Impl::end_default_tuning(second);
+      Impl::end_default_tuning(first);
+      if (++launches > 1000) {
+        throw std::runtime_error("Default tuner did not converge");
+      }
+    }
+    for (int count : tried) {
+      if (count == 0) throw std::runtime_error("Candidate never tried");
+    }
+
+    // kernels with automatic tiles and chunk sizes are tuned and still
+    // compute the right result
+    const int n = 100;
+    Kokkos::View<int**, ExecSpace> a("a", n, n);
+    Kokkos::View<int*, ExecSpace> b("b", n * n);
+    const int iterations = 300;
+    for (int iteration = 0; iteration < iterations; ++iteration) {
+      Kokkos::parallel_for(
+          "default_tuner_mdrange",
+          Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<2>>({0, 0}, {n, n}),
+          TestMDFunctor{a});
+      Kokkos::parallel_for(
+          "default_tuner_range",
+          Kokkos::RangePolicy<ExecSpace, Kokkos::Schedule<Kokkos::Dynamic>>(
+              0, n * n),
+          TestRangeFunctor{b});
+    }
+    int errors = 0;
+    Kokkos::parallel_reduce(
+        "default_tuner_check", Kokkos::RangePolicy<ExecSpace>(0, n * n),
+        KOKKOS_LAMBDA(const int i, int& err) {
+          if (a(i / n, i % n) != iterations || b(i) != iterations) ++err;
+        },
+        errors);
+    if (errors != 0) {
+      throw std::runtime_error("Tuned kernels computed wrong results");
+    }
+
+#ifdef KOKKOS_ENABLE_OPENMP
+    // range launches on the OpenMP pool learn their serial threshold
+    if (std::is_same_v<ExecSpace, Kokkos::OpenMP> &&
+        Kokkos::Impl::get_host_serial_threshold("default_tuner_range")
+                .cost_per_iteration() < 0.) {
+      throw std::runtime_error("Serial threshold was not learned");
+    }
+
+    // a tuning tool chooses the serial threshold instead of the learning
+    Kokkos::Tools::Experimental::set_request_output_values_callback(
+        choose_serial_threshold);
+    Kokkos::View<int*, ExecSpace> thread("thread", n * n);
+    Kokkos::parallel_for(
+        "tool_serial_range", Kokkos::RangePolicy<ExecSpace>(0, n * n),
+        KOKKOS_LAMBDA(const int i) { thread(i) = omp_get_thread_num(); });
+    Kokkos::fence();
+    Kokkos::Tools::Experimental::set_request_output_values_callback(nullptr);
+    if (!serial_threshold_requested) {
+      throw std::runtime_error("Serial threshold was not offered to the tool");
+    }
+    for (int i = 0; i < n * n; ++i) {
+      if (std::is_same_v<ExecSpace, Kokkos::OpenMP> && thread(i) != thread(0)) {
+        throw std::runtime_error("Serial threshold of the tool was ignored");
+      }
+    }
+#endif
+  }
+  Kokkos::finalize();
+
+  // converged choices are written back next to the loaded ones
+  std::ifstream cache(cache_file);
+  std::string line;
+  bool found_cached = false, found_tiles = false;
+  while (std::getline(cache, line)) {
+    if (line == "1 3 cached_problem") found_cached = true;
+    if (line.find("default_tuner_mdrange|tile_size") != std::string::npos) {
+      found_tiles = true;
+    }
+  }
+  cache.close();
+  std::remove(cache_file.c_str());
+  if (!found_cached || !found_tiles) {
+    throw std::runtime_error("Tuning cache was not written");
+  }
+}
@@ -104,6 +104,10 @@ struct TestScanFunctor {
   using value_type = int;
   KOKKOS_FUNCTION void operator()(const index_type, value_type&, bool) const {}
 };
+struct TestTeamFunctor {
+  using member_type = Kokkos::TeamPolicy<>::member_type;
+  KOKKOS_FUNCTION void operator()(const member_type&) const {}
+};
 
 template <typename Lambda>
 void test_wrapper(const Lambda& lambda) {
@@ -636,6 +640,57 @@ TEST(kokkosp, metadata) {
   ASSERT_TRUE(success);
 }
 
+TEST(kokkosp, scratch_resize) {
+  using ExecutionSpace = Kokkos::DefaultExecutionSpace;
+  if (!std::is_same_v<ExecutionSpace::memory_space, Kokkos::HostSpace>)
+    GTEST_SKIP() << "only the host backends report scratch reallocations";
+#ifdef KOKKOS_ENABLE_HPX
+  if (std::is_same_v<ExecutionSpace, Kokkos::Experimental::HPX>)
+    GTEST_SKIP() << "HPX does not report scratch reallocations";
+#endif
+  using namespace Kokkos::Test::Tools;
+  listen_tool_events(Config::DisableAll(), Config::EnableKernels(),
+                     Config::EnableScratch());
+  auto launch_team = [](int bytes) {
+    Kokkos::parallel_for(
+        "dogs",
+        Kokkos::TeamPolicy<>(1, 1).set_scratch_size(1, Kokkos::PerTeam(bytes)),
+        TestTeamFunctor{});
+  };
+  // more than any other test asks for
+  constexpr int scratch_bytes = 1 << 22;
+
+  auto success = validate_event_set(
+      [=]() { launch_team(scratch_bytes); },
+      [=](BeginParallelForEvent begin_event, ResizeScratchEvent resize_event,
+          EndParallelForEvent end_event) {
+        if (end_event.kID != begin_event.kID) {
+          return MatchDiagnostic{false, {"No match on kID's"}};
+        }
+        if (resize_event.size < uint64_t(scratch_bytes) ||
+            resize_event.size <= resize_event.old_size) {
+          return MatchDiagnostic{false, {"Scratch did not grow enough"}};
+        }
+        return MatchDiagnostic{true};
+      });
+  ASSERT_TRUE(success);
+
+  // The scratch memory is kept for kernels that need less of it, whatever
+  // part of it they need
+  success = validate_absence(
+      [=]() {
+        int result;
+        Kokkos::parallel_reduce("dogs", Kokkos::RangePolicy<>(0, 1),
+                                TestReduceFunctor{}, Kokkos::Sum<int>(result));
+        launch_team(scratch_bytes / 2);
+        Kokkos::parallel_reduce("dogs", Kokkos::RangePolicy<>(0, 1),
+                                TestReduceFunctor{}, Kokkos::Sum<int>(result));
+        launch_team(scratch_bytes);
+      },
+      [=](ResizeScratchEvent) { return MatchDiagnostic{true}; });
+  ASSERT_TRUE(success);
+}
+
 TEST(kokkosp, profile_events) {
   using namespace Kokkos::Test::Tools;
   listen_tool_events(Config::DisableAll(), Config::EnableProfileEvents());
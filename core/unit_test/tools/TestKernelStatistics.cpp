@@ -0,0 +1,125 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+// This file tests the kernel statistics collected without a tool library
+
+#include <Kokkos_Core.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// Returns the line of a section of the report ending with the given label
+std::string find_line(const std::string& report, const std::string& section,
+                      const std::string& label) {
+  std::istringstream lines(report);
+  std::string line;
+  while (std::getline(lines, line) && line != "  " + section + ":") {
+  }
+  while (std::getline(lines, line) && line.compare(0, 4, "    ") == 0) {
+    if (line.size() >= label.size() &&
+        line.compare(line.size() - label.size(), label.size(), label) == 0) {
+      return line;
+    }
+  }
+  throw std::runtime_error("No statistics for '" + label + "' in:\n" + report);
+}
+
+// Returns the n-th whitespace separated field of a line
+std::string field(const std::string& line, int n) {
+  std::istringstream fields(line);
+  std::string value;
+  for (int i = 0; i <= n; ++i) fields >> value;
+  return value;
+}
+
+int main() {
+  Kokkos::initialize(
+      Kokkos::InitializationSettings().set_kernel_statistics(true));
+  {
+    if (!Kokkos::Tools::profileLibraryLoaded()) {
+      throw std::runtime_error("Kernel statistics should be active");
+    }
+
+    Kokkos::View<double*> a("a", 1000);
+    for (int i = 0; i < 3; ++i) {
+      Kokkos::parallel_for(
+          "kernel_statistics_for", a.extent(0),
+          KOKKOS_LAMBDA(const int j) { a(j) += j; });
+    }
+    double sum = 0.;
+    for (int i = 0; i < 2; ++i) {
+      Kokkos::parallel_reduce(
+          "kernel_statistics_reduce", a.extent(0),
+          KOKKOS_LAMBDA(const int j, double& update) { update += a(j); }, sum);
+    }
+    {
+      Kokkos::View<double*> b("b", 4000);
+      Kokkos::View<double*, Kokkos::HostSpace> c("c", 4000);
+      Kokkos::deep_copy(c, b);
+    }
+
+    // a kernel may end on another thread than the one that began it
+    auto const& callbacks = Kokkos::Tools::Experimental::get_callbacks();
+    uint64_t first_id  = 0;
+    uint64_t second_id = 0;
+    callbacks.begin_parallel_for("kernel_statistics_first", 0, &first_id);
+    callbacks.begin_parallel_for("kernel_statistics_second", 0, &second_id);
+    std::thread([&] { callbacks.end_parallel_for(first_id); }).join();
+    callbacks.end_parallel_for(second_id);
+
+    std::ostringstream report;
+    Kokkos::Tools::Impl::print_kernel_statistics(report);
+
+    auto for_line =
+        find_line(report.str(), "Kernels", "for     kernel_statistics_for");
+    if (field(for_line, 1) != "3") {
+      throw std::runtime_error("Wrong number of launches:\n" + for_line);
+    }
+    auto reduce_line =
+        find_line(report.str(), "Kernels", "reduce  kernel_statistics_reduce");
+    if (field(reduce_line, 1) != "2") {
+      throw std::runtime_error("Wrong number of launches:\n" + reduce_line);
+    }
+
+    for (auto label : {"kernel_statistics_first", "kernel_statistics_second"}) {
+      auto line = find_line(report.str(), "Kernels", label);
+      if (field(line, 1) != "1") {
+        throw std::runtime_error("Wrong number of launches:\n" + line);
+      }
+    }
+
+    const long long bytes = sizeof(double);
+    const std::string memory_space =
+        Kokkos::DefaultExecutionSpace::memory_space::name();
+    const std::string host_space = Kokkos::HostSpace::name();
+    auto copy_line = find_line(report.str(), "Deep copies",
+                               host_space + " <- " + memory_space);
+    if (std::stoll(field(copy_line, 2)) < 4000 * bytes) {
+      throw std::runtime_error("Wrong number of bytes copied:\n" + copy_line);
+    }
+
+    // the high-water mark includes a and b, which was deallocated since
+    auto memory_line = find_line(report.str(), "Memory spaces", memory_space);
+    if (std::stoll(field(memory_line, 0)) < 5000 * bytes) {
+      throw std::runtime_error("Wrong high-water mark:\n" + memory_line);
+    }
+    if (std::stoll(field(memory_line, 2)) >= 5000 * bytes) {
+      throw std::runtime_error("Deallocation not counted:\n" + memory_line);
+    }
+  }
+  Kokkos::finalize();
+}
@@ -530,6 +530,23 @@ struct DeallocateDataEvent final : public DataEvent<DeallocateDataEvent> {
       : DataEvent<DeallocateDataEvent>(h, n, p, s) {}
 };
 
+struct ResizeScratchEvent final
+    : public UniquelyIdentifiableEventType<ResizeScratchEvent> {
+  using SpaceHandleType = Kokkos::Profiling::SpaceHandle;
+  SpaceHandleType handle;
+  uint64_t old_size;
+  uint64_t size;
+
+  std::string descriptor() const override {
+    std::stringstream s;
+    s << "ResizeScratchEvent{ In space \"" << handle.name
+      << "\", old size: " << old_size << ", size: " << size << "}";
+    return s.str();
+  }
+  ResizeScratchEvent(SpaceHandleType h, uint64_t o_s, uint64_t s)
+      : handle(h), old_size(o_s), size(s) {}
+};
+
 struct CreateProfileSectionEvent final
     : public UniquelyIdentifiableEventType<CreateProfileSectionEvent> {
   std::string name;
@@ -815,6 +832,7 @@ struct ToolValidatorConfiguration {
     bool sections       = true;
     bool profile_events = true;
     bool metadata       = true;
+    bool scratch        = true;
   };
   struct Tuning {
     bool contexts          = true;
@@ -885,6 +903,7 @@ KOKKOS_IMPL_TOOLS_TEST_CONFIG_OPTION(Sections, profiling.sections, 2);
 KOKKOS_IMPL_TOOLS_TEST_CONFIG_OPTION(ProfileEvents, profiling.profile_events,
                                      2);
 KOKKOS_IMPL_TOOLS_TEST_CONFIG_OPTION(Metadata, profiling.metadata, 2);
+KOKKOS_IMPL_TOOLS_TEST_CONFIG_OPTION(Scratch, profiling.scratch, 2);
 KOKKOS_IMPL_TOOLS_TEST_CONFIG_OPTION(Contexts, tuning.contexts, 2);
 KOKKOS_IMPL_TOOLS_TEST_CONFIG_OPTION(TypeDeclarations, tuning.type_declarations,
                                      2);
@@ -921,6 +940,7 @@ struct ToggleProfiling : public std::integral_constant<int, 1> {
     ToggleSections<target_value>{}(config);
     ToggleProfileEvents<target_value>{}(config);
     ToggleMetadata<target_value>{}(config);
+    ToggleScratch<target_value>{}(config);
   }
 };
 
@@ -1041,6 +1061,14 @@ static void set_tool_events_impl(const ToolValidatorConfiguration& config) {
               handle, std::string(name), ptr, size));
         });
   }
+  if (config.profiling.scratch) {
+    Kokkos::Tools::Experimental::set_resize_scratch_callback(
+        [](Kokkos::Tools::SpaceHandle handle, const uint64_t old_size,
+           const uint64_t size) {
+          found_events.push_back(
+              std::make_shared<ResizeScratchEvent>(handle, old_size, size));
+        });
+  }
   if (config.profiling.copies) {
     Kokkos::Tools::Experimental::set_begin_deep_copy_callback(
         [](Kokkos::Tools::SpaceHandle dst_handle, const char* dst_name,
@@ -11,6 +11,8 @@ SPDX-License-Identifier: (BSD-3-Clause)
 
 #include <desul/atomics/Common.hpp>
 #include <desul/atomics/Lock_Array.hpp>
+#include <desul/atomics/Lock_Free_Fetch_Op_Host_16Byte.hpp>
+#include <desul/atomics/Operator_Function_Objects.hpp>
 #include <desul/atomics/Thread_Fence_GCC.hpp>
 #include <type_traits>
 
@@ -86,6 +88,15 @@ std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value, T> host_atomic_e
     dont_deduce_this_parameter_t<const T> val,
     MemoryOrder /*order*/,
     MemoryScope scope) {
+#ifdef DESUL_IMPL_HAVE_HOST_CMPXCHG16B
+  if constexpr (host_atomic_may_use_cmpxchg16b_v<T>) {
+    if (host_atomic_use_cmpxchg16b(dest)) {
+      T newval;
+      return host_cmpxchg16b_fetch_oper(
+          store_fetch_operator<T, const T>(), dest, val, newval);
+    }
+  }
+#endif
   // Acquire a lock for the address
   // clang-format off
   while (!lock_address((void*)dest, scope)) {}
@@ -106,6 +117,13 @@ host_atomic_compare_exchange(T* const dest,
                              dont_deduce_this_parameter_t<const T> val,
                              MemoryOrder /*order*/,
                              MemoryScope scope) {
+#ifdef DESUL_IMPL_HAVE_HOST_CMPXCHG16B
+  if constexpr (host_atomic_may_use_cmpxchg16b_v<T>) {
+    if (host_atomic_use_cmpxchg16b(dest)) {
+      return host_cmpxchg16b_compare_exchange(dest, compare, val);
+    }
+  }
+#endif
   // Acquire a lock for the address
   // clang-format off
   while (!lock_address((void*)dest, scope)) {}
@@ -11,6 +11,7 @@ SPDX-License-Identifier: (BSD-3-Clause)
 
 #include <desul/atomics/Common.hpp>
 #include <desul/atomics/Lock_Array.hpp>
+#include <desul/atomics/Lock_Free_Fetch_Op_Host_16Byte.hpp>
 #include <desul/atomics/Thread_Fence.hpp>
 #include <type_traits>
 
@@ -29,6 +30,14 @@ inline T host_atomic_fetch_oper(const Oper& op,
                                 dont_deduce_this_parameter_t<const T> val,
                                 MemoryOrder /*order*/,
                                 MemoryScope scope) {
+#ifdef DESUL_IMPL_HAVE_HOST_CMPXCHG16B
+  if constexpr (host_atomic_may_use_cmpxchg16b_v<T>) {
+    if (host_atomic_use_cmpxchg16b(dest)) {
+      T newval;
+      return host_cmpxchg16b_fetch_oper(op, dest, val, newval);
+    }
+  }
+#endif
   // Acquire a lock for the address
   while (!lock_address((void*)dest, scope)) {
   }
@@ -53,6 +62,15 @@ inline T host_atomic_oper_fetch(const Oper& op,
                                 dont_deduce_this_parameter_t<const T> val,
                                 MemoryOrder /*order*/,
                                 MemoryScope scope) {
+#ifdef DESUL_IMPL_HAVE_HOST_CMPXCHG16B
+  if constexpr (host_atomic_may_use_cmpxchg16b_v<T>) {
+    if (host_atomic_use_cmpxchg16b(dest)) {
+      T newval;
+      (void)host_cmpxchg16b_fetch_oper(op, dest, val, newval);
+      return newval;
+    }
+  }
+#endif
   // Acquire a lock for the address
   while (!lock_address((void*)dest, scope)) {
   }
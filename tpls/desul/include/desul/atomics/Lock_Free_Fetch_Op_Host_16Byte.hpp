@@ -0,0 +1,110 @@
+/*
+Copyright (c) 2019, Lawrence Livermore National Security, LLC
+and DESUL project contributors. See the COPYRIGHT file for details.
+Source: https://github.com/desul/desul
+
+SPDX-License-Identifier: (BSD-3-Clause)
+*/
+
+#ifndef DESUL_ATOMICS_LOCK_FREE_FETCH_OP_HOST_16BYTE_HPP_
+#define DESUL_ATOMICS_LOCK_FREE_FETCH_OP_HOST_16BYTE_HPP_
+
+#include <desul/atomics/Common.hpp>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// 16-byte types are not always lock free on x86-64 with GCC-like compilers since
+// cmpxchg16b is missing from the first processors of the architecture and GCC
+// only inlines it with -mcx16.  The host atomics on such types check at runtime
+// whether the processor supports it and otherwise fall back to the lock array.
+//
+// This header and its uses in Lock_Based_Fetch_Op_Host.hpp and
+// Compare_Exchange_GCC.hpp are local changes to the copy of desul vendored by
+// Kokkos, which still need to be contributed upstream.
+#if !defined(DESUL_HAVE_16BYTE_COMPARE_AND_SWAP) && defined(__x86_64__) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define DESUL_IMPL_HAVE_HOST_CMPXCHG16B
+#include <cpuid.h>
+#endif
+
+namespace desul {
+namespace Impl {
+
+#ifdef DESUL_IMPL_HAVE_HOST_CMPXCHG16B
+
+inline bool host_cmpxchg16b_available() {
+  static const bool available = [] {
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_CMPXCHG16B);
+  }();
+  return available;
+}
+
+// Returns the value of *dest, which is replaced by desired if it was equal to
+// expected.  The lock prefix makes it a full barrier, whatever the memory order.
+inline Dummy16ByteValue host_cmpxchg16b(Dummy16ByteValue* dest,
+                                        Dummy16ByteValue expected,
+                                        Dummy16ByteValue desired) {
+  __asm__ __volatile__("lock cmpxchg16b %0"
+                       : "+m"(*dest), "+a"(expected.value1), "+d"(expected.value2)
+                       : "b"(desired.value1), "c"(desired.value2)
+                       : "cc", "memory");
+  return expected;
+}
+
+template <class T>
+inline constexpr bool host_atomic_may_use_cmpxchg16b_v =
+    sizeof(T) == 16 && std::is_trivially_copyable<T>::value &&
+    std::is_default_constructible<T>::value;
+
+// Whether the atomic operations on *dest can use cmpxchg16b instead of the lock
+// array.  The decision only depends on the type, the address and the processor,
+// so that all the atomic operations on the same object take the same path.
+template <class T>
+bool host_atomic_use_cmpxchg16b(const T* const dest) {
+  return host_atomic_may_use_cmpxchg16b_v<T> &&
+         reinterpret_cast<std::uintptr_t>(dest) % 16 == 0 &&
+         host_cmpxchg16b_available();
+}
+
+// Applies op with cmpxchg16b, returns the old value and sets newval
+template <class Oper, class T>
+T host_cmpxchg16b_fetch_oper(const Oper& op, T* const dest, const T& val, T& newval) {
+  static_assert(sizeof(T) == sizeof(Dummy16ByteValue));
+  auto* const dest16 = reinterpret_cast<Dummy16ByteValue*>(dest);
+  // A torn read only costs one more iteration
+  Dummy16ByteValue oldval;
+  std::memcpy(&oldval, dest, sizeof(T));
+  Dummy16ByteValue assume;
+  T old;
+  do {
+    assume = oldval;
+    std::memcpy(static_cast<void*>(&old), &assume, sizeof(T));
+    newval = op.apply(old, val);
+    Dummy16ByteValue desired;
+    std::memcpy(&desired, &newval, sizeof(T));
+    oldval = host_cmpxchg16b(dest16, assume, desired);
+  } while (assume != oldval);
+  return old;
+}
+
+template <class T>
+T host_cmpxchg16b_compare_exchange(T* const dest, const T& compare, const T& val) {
+  static_assert(sizeof(T) == sizeof(Dummy16ByteValue));
+  Dummy16ByteValue expected, desired;
+  std::memcpy(&expected, &compare, sizeof(T));
+  std::memcpy(&desired, &val, sizeof(T));
+  const Dummy16ByteValue oldval =
+      host_cmpxchg16b(reinterpret_cast<Dummy16ByteValue*>(dest), expected, desired);
+  T old;
+  std::memcpy(static_cast<void*>(&old), &oldval, sizeof(T));
+  return old;
+}
+
+#endif
+
+}  // namespace Impl
+}  // namespace desul
+
+#endif